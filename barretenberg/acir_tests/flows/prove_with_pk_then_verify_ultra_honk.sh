@@ -0,0 +1,15 @@
+#!/bin/sh
+set -eux
+
+VFLAG=${VERBOSE:+-v}
+BFLAG="-b ./target/program.json"
+FLAGS="-c $CRS_PATH $VFLAG"
+if [ "${RECURSIVE}" = "true" ]; then
+    FLAGS="$FLAGS --recursive"
+fi
+
+# Test that a proof constructed from a precomputed proving key verifies against an independently computed vk.
+$BIN write_pk_ultra_honk -o pk $FLAGS $BFLAG
+$BIN prove_ultra_honk --pk pk -o proof $FLAGS $BFLAG
+$BIN write_vk_ultra_honk -o vk $FLAGS $BFLAG
+$BIN verify_ultra_honk -k vk -p proof $FLAGS
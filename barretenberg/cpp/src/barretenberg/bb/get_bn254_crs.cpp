@@ -1,5 +1,6 @@
 #include "get_bn254_crs.hpp"
 #include "barretenberg/bb/file_io.hpp"
+#include "barretenberg/srs/factories/point_table_cache.hpp"
 
 namespace {
 std::vector<uint8_t> download_bn254_g1_data(size_t num_points)
@@ -58,6 +59,28 @@ std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& p
     return points;
 }
 
+/**
+ * @brief Returns the path of a pippenger point table cache holding at least num_points points, building it from the
+ * g1 data if needed
+ * @details Once built, provers mmap the cache instead of parsing bn254_g1.dat and regenerating the point table.
+ */
+std::filesystem::path get_bn254_point_table_cache(const std::filesystem::path& path, size_t num_points)
+{
+    std::filesystem::create_directories(path);
+
+    auto cache_path = path / "bn254_g1_pippenger.dat";
+    auto cached_size = srs::factories::get_point_table_cache_size<curve::BN254>(cache_path);
+    if (cached_size >= num_points) {
+        vinfo("using cached bn254 point table of size ", cached_size, " at ", cache_path);
+        return cache_path;
+    }
+
+    auto points = get_bn254_g1_data(path, num_points);
+    vinfo("writing bn254 point table cache of size ", num_points, " to ", cache_path);
+    srs::factories::write_point_table_cache<curve::BN254>(cache_path, points);
+    return cache_path;
+}
+
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path)
 {
     std::filesystem::create_directories(path);
@@ -11,4 +11,5 @@
 namespace bb {
 std::vector<g1::affine_element> get_bn254_g1_data(const std::filesystem::path& path, size_t num_points);
 g2::affine_element get_bn254_g2_data(const std::filesystem::path& path);
+std::filesystem::path get_bn254_point_table_cache(const std::filesystem::path& path, size_t num_points);
 } // namespace bb
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include "barretenberg/stdlib/client_ivc_verifier/client_ivc_recursive_verifier.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include "barretenberg/ultra_honk/precomputed_proving_key.hpp"
 
 #include <cstddef>
 #ifndef DISABLE_AZTEC_VM
@@ -29,6 +30,7 @@
 #include "get_grumpkin_crs.hpp"
 #include "libdeflate.h"
 #include "log.hpp"
+#include "server.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/common/log.hpp>
@@ -36,9 +38,11 @@
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
 #include <barretenberg/srs/global_crs.hpp>
+#include <csignal>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -61,12 +65,36 @@ const auto current_dir = current_path.filename().string();
  *
  * @param dyadic_circuit_size power-of-2 circuit size
  */
+// Number of bn254 prover CRS points held by the global crs_factory, and whether it can serve verifiers. Lets
+// long-running modes (bb server) reuse the CRS across requests.
+size_t loaded_bn254_crs_size = 0;
+bool loaded_bn254_verifier_crs = false;
+
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
     // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + 1);
+    if (loaded_bn254_crs_size >= dyadic_circuit_size + 1) {
+        return;
+    }
+    auto bn254_point_table = get_bn254_point_table_cache(CRS_PATH, dyadic_circuit_size + 1);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
+    srs::init_crs_factory_from_point_table_cache(bn254_point_table, dyadic_circuit_size + 1, bn254_g2_data);
+    loaded_bn254_crs_size = dyadic_circuit_size + 1;
+    loaded_bn254_verifier_crs = true;
+}
+
+/**
+ * @brief Initialize the global crs_factory for bn254 verification only, i.e. without loading G1
+ * @details A no-op if the factory already holds a CRS, since any bn254 CRS can serve verifiers.
+ */
+void init_bn254_verifier_crs()
+{
+    if (loaded_bn254_verifier_crs) {
+        return;
+    }
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory({}, g2_data);
+    loaded_bn254_verifier_crs = true;
 }
 
 /**
@@ -86,8 +114,7 @@ void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 acir_proofs::AcirComposer verifier_init()
 {
     acir_proofs::AcirComposer acir_composer(0, verbose_logging);
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
     return acir_composer;
 }
 
@@ -848,8 +875,7 @@ void contract_honk(const std::string& output_path, const std::string& vk_path)
     using VerificationKey = UltraKeccakFlavor::VerificationKey;
     using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
 
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
     auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
     vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
 
@@ -1061,15 +1087,20 @@ bool avm_verify(const std::filesystem::path& proof_path, const std::filesystem::
  * @tparam Flavor
  * @param bytecodePath
  * @param witnessPath
+ * @param pkPath Optional path to a proving key written by write_pk_honk for this program, from which the precomputed
+ * polynomials are mapped instead of being computed
  * @return UltraProver_<Flavor>
  */
 template <typename Flavor>
 UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath,
                                           const std::string& witnessPath,
-                                          const bool recursive)
+                                          const bool recursive,
+                                          const std::string& pkPath = "")
 {
     using Builder = Flavor::CircuitBuilder;
     using Prover = UltraProver_<Flavor>;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using PrecomputedProvingKey = PrecomputedProvingKey_<Flavor>;
 
     bool honk_recursion = false;
     if constexpr (IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor>) {
@@ -1082,7 +1113,12 @@ UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath,
     }
 
     auto builder = acir_format::create_circuit<Builder>(constraint_system, recursive, 0, witness, honk_recursion);
-    auto prover = Prover{ builder };
+    std::shared_ptr<PrecomputedProvingKey> precomputed;
+    if (!pkPath.empty()) {
+        precomputed = PrecomputedProvingKey::read(pkPath);
+        vinfo("using precomputed proving key at ", pkPath);
+    }
+    auto prover = Prover{ std::make_shared<DeciderProvingKey>(builder, TraceSettings{}, nullptr, precomputed) };
     init_bn254_crs(prover.proving_key->proving_key.circuit_size);
     return std::move(prover);
 }
@@ -1097,18 +1133,20 @@ UltraProver_<Flavor> compute_valid_prover(const std::string& bytecodePath,
  * @param bytecodePath Path to the file containing the serialized circuit
  * @param witnessPath Path to the file containing the serialized witness
  * @param outputPath Path to write the proof to
+ * @param pkPath Optional path to a proving key for the circuit written by write_pk_honk
  */
 template <IsUltraFlavor Flavor>
 void prove_honk(const std::string& bytecodePath,
                 const std::string& witnessPath,
                 const std::string& outputPath,
-                const bool recursive)
+                const bool recursive,
+                const std::string& pkPath = "")
 {
     // using Builder = Flavor::CircuitBuilder;
     using Prover = UltraProver_<Flavor>;
 
     // Construct Honk proof
-    Prover prover = compute_valid_prover<Flavor>(bytecodePath, witnessPath, recursive);
+    Prover prover = compute_valid_prover<Flavor>(bytecodePath, witnessPath, recursive, pkPath);
     auto proof = prover.construct_proof();
     if (outputPath == "-") {
         writeRawBytesToStdout(to_buffer</*include_size=*/true>(proof));
@@ -1119,6 +1157,43 @@ void prove_honk(const std::string& bytecodePath,
     }
 }
 
+/**
+ * @brief Reads a Honk verification key from a file
+ * @details Up to MAX_CACHED_VKS keys stay resident, keyed by path and checked against the modification time, so that
+ * repeated verifications in one process (bb server) neither re-read nor re-deserialize them. A key whose file changed
+ * replaces its stale entry, and once the cache is full the least recently used key is dropped.
+ */
+template <IsUltraFlavor Flavor>
+std::shared_ptr<typename Flavor::VerificationKey> load_honk_vk(const std::string& vk_path)
+{
+    using VerificationKey = Flavor::VerificationKey;
+    using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
+    struct CachedVk {
+        std::filesystem::file_time_type last_write_time;
+        std::shared_ptr<VerificationKey> vk;
+        uint64_t last_use;
+    };
+    static constexpr size_t MAX_CACHED_VKS = 16;
+
+    static std::map<std::string, CachedVk> vk_cache;
+    static uint64_t use_counter = 0;
+    const auto last_write_time = std::filesystem::last_write_time(vk_path);
+    auto it = vk_cache.find(vk_path);
+    if (it != vk_cache.end() && it->second.last_write_time == last_write_time) {
+        it->second.last_use = ++use_counter;
+        return it->second.vk;
+    }
+    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
+    vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
+    if (it == vk_cache.end() && vk_cache.size() >= MAX_CACHED_VKS) {
+        vk_cache.erase(std::min_element(vk_cache.begin(), vk_cache.end(), [](const auto& a, const auto& b) {
+            return a.second.last_use < b.second.last_use;
+        }));
+    }
+    vk_cache[vk_path] = CachedVk{ last_write_time, vk, ++use_counter };
+    return vk;
+}
+
 /**
  * @brief Verifies a proof for an ACIR circuit
  *
@@ -1136,15 +1211,11 @@ void prove_honk(const std::string& bytecodePath,
  */
 template <IsUltraFlavor Flavor> bool verify_honk(const std::string& proof_path, const std::string& vk_path)
 {
-    using VerificationKey = Flavor::VerificationKey;
     using Verifier = UltraVerifier_<Flavor>;
-    using VerifierCommitmentKey = bb::VerifierCommitmentKey<curve::BN254>;
 
-    auto g2_data = get_bn254_g2_data(CRS_PATH);
-    srs::init_crs_factory({}, g2_data);
+    init_bn254_verifier_crs();
     auto proof = from_buffer<std::vector<bb::fr>>(read_file(proof_path));
-    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
-    vk->pcs_verification_key = std::make_shared<VerifierCommitmentKey>();
+    auto vk = load_honk_vk<Flavor>(vk_path);
     Verifier verifier{ vk };
 
     bool verified = verifier.verify_proof(proof);
@@ -1183,6 +1254,42 @@ void write_vk_honk(const std::string& bytecodePath, const std::string& outputPat
     }
 }
 
+/**
+ * @brief Writes the precomputed half of a Honk proving key for an ACIR circuit to a file
+ * @details The key holds the selector, permutation, table and Lagrange polynomials of the circuit, and is identified by
+ * the hash of its verification key. Passing it to prove_honk (`--pk`) lets repeated proofs of the circuit map these
+ * polynomials, shared read-only between processes, and only construct the witness polynomials.
+ *
+ * Communication:
+ * - Filesystem: The proving key is written to the path specified by outputPath (it is meant to be mmap'ed, so it
+ *   cannot be written to stdout)
+ *
+ * @param bytecodePath Path to the file containing the serialized circuit
+ * @param outputPath Path to write the proving key to
+ */
+template <IsUltraFlavor Flavor>
+void write_pk_honk(const std::string& bytecodePath, const std::string& outputPath, const bool recursive)
+{
+    using Builder = Flavor::CircuitBuilder;
+    using VerificationKey = Flavor::VerificationKey;
+
+    if (outputPath == "-") {
+        throw std::runtime_error("Honk proving keys cannot be written to stdout");
+    }
+    // The builder is kept, rather than going through compute_valid_prover, as the key file fingerprints the circuit
+    const bool honk_recursion = IsAnyOf<Flavor, UltraFlavor, UltraKeccakFlavor>;
+    auto constraint_system = get_constraint_system(bytecodePath, honk_recursion);
+    auto builder = acir_format::create_circuit<Builder>(constraint_system, recursive, 0, {}, honk_recursion);
+    DeciderProvingKey_<Flavor> decider_proving_key(builder);
+    auto& proving_key = decider_proving_key.proving_key;
+    init_bn254_crs(proving_key.circuit_size);
+    VerificationKey vk(proving_key);
+    const uint256_t vk_hash = vk.hash();
+
+    PrecomputedProvingKey_<Flavor>::write(outputPath, proving_key, builder, vk_hash);
+    vinfo("pk for vk hash ", vk_hash, " written to: ", outputPath);
+}
+
 /**
  * @brief Write a toml file containing recursive verifier inputs for a given program + witness
  *
@@ -1399,6 +1506,74 @@ void prove_honk_output_all(const std::string& bytecodePath,
     vinfo("vk as fields written to: ", vkFieldsOutputPath);
 }
 
+/**
+ * @brief Registers the prove, verify and write_vk request handlers of a Honk flavor with a bb server dispatcher
+ */
+template <IsUltraFlavor Flavor>
+void register_honk_server_targets(messaging::MessageDispatcher& dispatcher,
+                                  uint32_t prove_type,
+                                  uint32_t verify_type,
+                                  uint32_t write_vk_type)
+{
+    // Responses share the byte stream with stdout, so requests may not write their outputs there.
+    auto check_output_path = [](const std::string& output_path) {
+        if (output_path == "-") {
+            throw std::runtime_error("bb server cannot write outputs to stdout");
+        }
+    };
+    dispatcher.registerTarget(prove_type, [=](msgpack::object& obj, msgpack::sbuffer& buffer) {
+        return server::handle_request<server::ProveRequest>(
+            prove_type, obj, buffer, [&](const server::ProveRequest& request) {
+                check_output_path(request.outputPath);
+                prove_honk<Flavor>(request.bytecodePath, request.witnessPath, request.outputPath, request.recursive);
+                return true;
+            });
+    });
+    dispatcher.registerTarget(verify_type, [=](msgpack::object& obj, msgpack::sbuffer& buffer) {
+        return server::handle_request<server::VerifyRequest>(
+            verify_type, obj, buffer, [&](const server::VerifyRequest& request) {
+                return verify_honk<Flavor>(request.proofPath, request.vkPath);
+            });
+    });
+    dispatcher.registerTarget(write_vk_type, [=](msgpack::object& obj, msgpack::sbuffer& buffer) {
+        return server::handle_request<server::WriteVkRequest>(
+            write_vk_type, obj, buffer, [&](const server::WriteVkRequest& request) {
+                check_output_path(request.outputPath);
+                write_vk_honk<Flavor>(request.bytecodePath, request.outputPath, request.recursive);
+                return true;
+            });
+    });
+}
+
+/**
+ * @brief Runs bb as a long-lived prover daemon, see server.hpp for the protocol
+ *
+ * Communication:
+ * - stdin/stdout: framed msgpack requests and responses, unless a socket path is given
+ * - UNIX socket: framed msgpack requests and responses on each accepted connection
+ *
+ * @param socket_path Path of the UNIX socket to listen on, or empty to serve stdin/stdout
+ */
+void serve(const std::string& socket_path)
+{
+    messaging::MessageDispatcher dispatcher;
+    register_honk_server_targets<UltraFlavor>(
+        dispatcher, server::PROVE_ULTRA_HONK, server::VERIFY_ULTRA_HONK, server::WRITE_VK_ULTRA_HONK);
+    register_honk_server_targets<MegaFlavor>(
+        dispatcher, server::PROVE_MEGA_HONK, server::VERIFY_MEGA_HONK, server::WRITE_VK_MEGA_HONK);
+
+    // A peer that goes away before its response is written must not kill the daemon: writes fail with EPIPE instead
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if (socket_path.empty()) {
+        vinfo("bb server listening on stdin");
+        server::serve_stream(STDIN_FILENO, STDOUT_FILENO, dispatcher);
+    } else {
+        vinfo("bb server listening on ", socket_path);
+        server::serve_unix_socket(socket_path, dispatcher);
+    }
+}
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -1428,6 +1603,7 @@ int main(int argc, char* argv[])
         std::string proof_path = get_option(args, "-p", "./proofs/proof");
         std::string vk_path = get_option(args, "-k", "./target/vk");
         std::string pk_path = get_option(args, "-r", "./target/pk");
+        std::string honk_pk_path = get_option(args, "--pk", "");
         bool honk_recursion = flag_present(args, "-h");
         bool recursive = flag_present(args, "--recursive"); // Not every flavor handles it.
         CRS_PATH = get_option(args, "-c", CRS_PATH);
@@ -1470,6 +1646,10 @@ int main(int argc, char* argv[])
         if (command == "fold_and_verify_program") {
             return foldAndVerifyProgram(bytecode_path, witness_path) ? 0 : 1;
         }
+        if (command == "server") {
+            serve(get_option(args, "--socket", ""));
+            return 0;
+        }
 
         if (command == "prove") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
@@ -1537,10 +1717,10 @@ int main(int argc, char* argv[])
 #endif
         } else if (command == "prove_ultra_honk") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
-            prove_honk<UltraFlavor>(bytecode_path, witness_path, output_path, recursive);
+            prove_honk<UltraFlavor>(bytecode_path, witness_path, output_path, recursive, honk_pk_path);
         } else if (command == "prove_ultra_keccak_honk") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
-            prove_honk<UltraKeccakFlavor>(bytecode_path, witness_path, output_path, recursive);
+            prove_honk<UltraKeccakFlavor>(bytecode_path, witness_path, output_path, recursive, honk_pk_path);
         } else if (command == "prove_ultra_keccak_honk_output_all") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
             prove_honk_output_all<UltraKeccakFlavor>(bytecode_path, witness_path, output_path, recursive);
@@ -1554,14 +1734,23 @@ int main(int argc, char* argv[])
         } else if (command == "write_vk_ultra_keccak_honk") {
             std::string output_path = get_option(args, "-o", "./target/vk");
             write_vk_honk<UltraKeccakFlavor>(bytecode_path, output_path, recursive);
+        } else if (command == "write_pk_ultra_honk") {
+            std::string output_path = get_option(args, "-o", "./target/pk");
+            write_pk_honk<UltraFlavor>(bytecode_path, output_path, recursive);
+        } else if (command == "write_pk_ultra_keccak_honk") {
+            std::string output_path = get_option(args, "-o", "./target/pk");
+            write_pk_honk<UltraKeccakFlavor>(bytecode_path, output_path, recursive);
         } else if (command == "prove_mega_honk") {
             std::string output_path = get_option(args, "-o", "./proofs/proof");
-            prove_honk<MegaFlavor>(bytecode_path, witness_path, output_path, recursive);
+            prove_honk<MegaFlavor>(bytecode_path, witness_path, output_path, recursive, honk_pk_path);
         } else if (command == "verify_mega_honk") {
             return verify_honk<MegaFlavor>(proof_path, vk_path) ? 0 : 1;
         } else if (command == "write_vk_mega_honk") {
             std::string output_path = get_option(args, "-o", "./target/vk");
             write_vk_honk<MegaFlavor>(bytecode_path, output_path, recursive);
+        } else if (command == "write_pk_mega_honk") {
+            std::string output_path = get_option(args, "-o", "./target/pk");
+            write_pk_honk<MegaFlavor>(bytecode_path, output_path, recursive);
         } else if (command == "proof_as_fields_honk") {
             std::string output_path = get_option(args, "-o", proof_path + "_fields.json");
             proof_as_fields_honk(proof_path, output_path);
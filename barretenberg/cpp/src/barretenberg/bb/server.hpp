@@ -0,0 +1,285 @@
+#pragma once
+#include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * `bb server` keeps a single process alive across many requests so that the CRS, verification keys and the
+ * circuit-independent plookup tables stay resident, and small proofs no longer pay process startup.
+ *
+ * Transport: every message, in both directions, is a 4-byte little endian length followed by a msgpack encoded
+ * `TypedMessage` (see messaging/header.hpp). Requests are processed in the order they arrive, so clients may pipeline
+ * several requests and match responses using `header.requestId`, which echoes the request's `header.messageId`.
+ * The system messages of messaging/header.hpp are honoured: PING is answered with PONG and TERMINATE closes the
+ * connection.
+ *
+ * A frame that cannot be handled (not msgpack, an unknown message type, a malformed request, or longer than
+ * MAX_FRAME_SIZE) is answered with an unsuccessful ServerResponse, and the server moves on to the next frame. Only a
+ * stream that ends in the middle of a frame ends the connection with an error.
+ */
+namespace bb::server {
+
+using namespace bb::messaging;
+
+enum BbServerMessageType {
+    PROVE_ULTRA_HONK = FIRST_APP_MSG_TYPE,
+    VERIFY_ULTRA_HONK,
+    WRITE_VK_ULTRA_HONK,
+    PROVE_MEGA_HONK,
+    VERIFY_MEGA_HONK,
+    WRITE_VK_MEGA_HONK,
+};
+
+struct ProveRequest {
+    std::string bytecodePath;
+    std::string witnessPath;
+    std::string outputPath;
+    bool recursive;
+    MSGPACK_FIELDS(bytecodePath, witnessPath, outputPath, recursive);
+};
+
+struct VerifyRequest {
+    std::string proofPath;
+    std::string vkPath;
+    MSGPACK_FIELDS(proofPath, vkPath);
+};
+
+struct WriteVkRequest {
+    std::string bytecodePath;
+    std::string outputPath;
+    bool recursive;
+    MSGPACK_FIELDS(bytecodePath, outputPath, recursive);
+};
+
+struct ServerResponse {
+    // For verify requests, whether the proof verified. Otherwise whether the request succeeded.
+    bool success;
+    std::string error;
+    // Time spent handling the request, excluding transport
+    uint64_t latencyUs;
+    MSGPACK_FIELDS(success, error, latencyUs);
+};
+
+// Requests only carry paths and flags, so anything longer is a corrupt length prefix rather than a real request.
+static constexpr uint32_t MAX_FRAME_SIZE = 1 << 20;
+
+/**
+ * @brief Runs a request handler, timing it and packing a ServerResponse addressed to the request
+ *
+ * @param handler Returns the `success` field of the response. Exceptions become unsuccessful responses.
+ */
+template <typename Request, typename Handler>
+bool handle_request(uint32_t msg_type, msgpack::object& obj, msgpack::sbuffer& buffer, Handler&& handler)
+{
+    TypedMessage<Request> request;
+    obj.convert(request);
+
+    ServerResponse response{ false, "", 0 };
+    auto start = std::chrono::steady_clock::now();
+    try {
+        response.success = handler(request.value);
+    } catch (std::exception const& e) {
+        response.error = e.what();
+    }
+    response.latencyUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    MsgHeader header(request.header.messageId);
+    TypedMessage<ServerResponse> resp_msg(msg_type, header, response);
+    msgpack::pack(buffer, resp_msg);
+    return true;
+}
+
+// Reads exactly size bytes, returns false on a clean end of stream before the first byte.
+inline bool read_exact(int fd, char* data, size_t size)
+{
+    size_t read_so_far = 0;
+    while (read_so_far < size) {
+        ssize_t n = ::read(fd, data + read_so_far, size - read_so_far);
+        if (n == 0 && read_so_far == 0) {
+            return false;
+        }
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("bb server: truncated message");
+        }
+        read_so_far += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// Writes all of data. On a socket this uses send() without SIGPIPE, so a client that has gone away surfaces as an
+// error for its connection rather than killing the server.
+inline void write_exact(int fd, const char* data, size_t size)
+{
+#ifdef MSG_NOSIGNAL
+    bool is_socket = true;
+#else
+    bool is_socket = false;
+#endif
+    while (size > 0) {
+        ssize_t n = -1;
+#ifdef MSG_NOSIGNAL
+        if (is_socket) {
+            n = ::send(fd, data, size, MSG_NOSIGNAL);
+            if (n < 0 && errno == ENOTSOCK) {
+                is_socket = false;
+                continue;
+            }
+        }
+#endif
+        if (!is_socket) {
+            n = ::write(fd, data, size);
+        }
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("bb server: write failed: ") + std::strerror(errno));
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+}
+
+inline void write_frame(int fd, const char* data, size_t size)
+{
+    std::array<char, 4> length{};
+    for (size_t i = 0; i < 4; i++) {
+        length[i] = static_cast<char>((size >> (8 * i)) & 0xff);
+    }
+    write_exact(fd, length.data(), length.size());
+    write_exact(fd, data, size);
+}
+
+// Reads and drops size bytes, so that the next frame can be read after one that is not handled.
+inline void skip_exact(int fd, size_t size)
+{
+    std::array<char, 4096> scratch{};
+    while (size > 0) {
+        const size_t chunk = std::min(size, scratch.size());
+        if (!read_exact(fd, scratch.data(), chunk)) {
+            throw std::runtime_error("bb server: truncated message");
+        }
+        size -= chunk;
+    }
+}
+
+/**
+ * @brief Serves framed requests read from in_fd, writing responses to out_fd, until end of stream or TERMINATE
+ */
+inline void serve_stream(int in_fd, int out_fd, MessageDispatcher& dispatcher)
+{
+    const auto write_error = [&](const HeaderOnlyMessage& header, const std::string& error) {
+        MsgHeader resp_header(header.header.messageId);
+        TypedMessage<ServerResponse> resp_msg(header.msgType, resp_header, ServerResponse{ false, error, 0 });
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, resp_msg);
+        write_frame(out_fd, buffer.data(), buffer.size());
+    };
+
+    std::vector<char> frame;
+    while (true) {
+        std::array<unsigned char, 4> length_bytes{};
+        if (!read_exact(in_fd, reinterpret_cast<char*>(length_bytes.data()), length_bytes.size())) {
+            return;
+        }
+        const uint32_t length = static_cast<uint32_t>(length_bytes[0]) | (static_cast<uint32_t>(length_bytes[1]) << 8) |
+                                (static_cast<uint32_t>(length_bytes[2]) << 16) |
+                                (static_cast<uint32_t>(length_bytes[3]) << 24);
+        // Until the header is parsed, errors are reported against message type and id 0.
+        HeaderOnlyMessage header{};
+        if (length > MAX_FRAME_SIZE) {
+            skip_exact(in_fd, length);
+            write_error(header,
+                        "bb server: message of " + std::to_string(length) + " bytes exceeds the maximum of " +
+                            std::to_string(MAX_FRAME_SIZE));
+            continue;
+        }
+        frame.resize(length);
+        if (length > 0 && !read_exact(in_fd, frame.data(), length)) {
+            throw std::runtime_error("bb server: truncated message");
+        }
+
+        msgpack::sbuffer buffer;
+        try {
+            msgpack::object_handle obj_handle = msgpack::unpack(frame.data(), length);
+            msgpack::object obj = obj_handle.get();
+            obj.convert(header);
+
+            if (header.msgType == SystemMsgTypes::TERMINATE) {
+                return;
+            }
+            if (header.msgType == SystemMsgTypes::PING) {
+                MsgHeader pong_header(header.header.messageId);
+                msgpack::pack(buffer, HeaderOnlyMessage(SystemMsgTypes::PONG, pong_header));
+            } else {
+                dispatcher.onNewData(obj, buffer);
+            }
+        } catch (std::exception const& e) {
+            write_error(header, std::string("bb server: malformed message: ") + e.what());
+            continue;
+        }
+        write_frame(out_fd, buffer.data(), buffer.size());
+    }
+}
+
+/**
+ * @brief Listens on a UNIX domain socket and serves each connection in turn
+ * @details Connections are served sequentially since every request already uses all cores.
+ */
+inline void serve_unix_socket(const std::string& socket_path, MessageDispatcher& dispatcher)
+{
+    int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw std::runtime_error(std::string("bb server: socket failed: ") + std::strerror(errno));
+    }
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        ::close(listen_fd);
+        throw std::runtime_error("bb server: socket path too long: " + socket_path);
+    }
+    std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    ::unlink(socket_path.c_str());
+    if (::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0 || ::listen(listen_fd, 1) < 0) {
+        ::close(listen_fd);
+        throw std::runtime_error(std::string("bb server: cannot listen on ") + socket_path + ": " +
+                                 std::strerror(errno));
+    }
+
+    while (true) {
+        int conn_fd = ::accept(listen_fd, nullptr, nullptr);
+        if (conn_fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        try {
+            serve_stream(conn_fd, conn_fd, dispatcher);
+        } catch (std::exception const& e) {
+            std::cerr << e.what() << std::endl;
+        }
+        ::close(conn_fd);
+    }
+    ::close(listen_fd);
+    ::unlink(socket_path.c_str());
+}
+
+} // namespace bb::server
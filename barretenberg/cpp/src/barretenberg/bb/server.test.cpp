@@ -0,0 +1,210 @@
+#include "server.hpp"
+#include <csignal>
+#include <cstdio>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+using namespace bb::server;
+
+namespace {
+
+constexpr uint32_t ECHO = FIRST_APP_MSG_TYPE;
+
+struct EchoRequest {
+    std::string text;
+    MSGPACK_FIELDS(text);
+};
+
+/**
+ * @brief Runs serve_stream over the given raw input bytes and returns the response frames, unpacked
+ * @details Both ends are temporary files so that large inputs never block on a pipe.
+ */
+class ServerStreamTest : public ::testing::Test {
+  protected:
+    MessageDispatcher dispatcher;
+    std::string input;
+
+    void SetUp() override
+    {
+        dispatcher.registerTarget(ECHO, [](msgpack::object& obj, msgpack::sbuffer& buffer) {
+            return handle_request<EchoRequest>(ECHO, obj, buffer, [](const EchoRequest& request) {
+                if (request.text.empty()) {
+                    throw std::runtime_error("empty");
+                }
+                return true;
+            });
+        });
+    }
+
+    void add_raw_frame(uint32_t length, const std::string& data)
+    {
+        for (size_t i = 0; i < 4; i++) {
+            input.push_back(static_cast<char>((length >> (8 * i)) & 0xff));
+        }
+        input += data;
+    }
+
+    template <typename T> void add_frame(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        add_raw_frame(static_cast<uint32_t>(buffer.size()), std::string(buffer.data(), buffer.size()));
+    }
+
+    void add_ping(uint32_t message_id)
+    {
+        MsgHeader header(message_id, 0);
+        add_frame(HeaderOnlyMessage(SystemMsgTypes::PING, header));
+    }
+
+    void add_echo(uint32_t message_id, const std::string& text)
+    {
+        MsgHeader header(message_id, 0);
+        add_frame(TypedMessage<EchoRequest>(ECHO, header, EchoRequest{ text }));
+    }
+
+    std::vector<msgpack::object_handle> serve()
+    {
+        FILE* in = std::tmpfile();
+        FILE* out = std::tmpfile();
+        std::fwrite(input.data(), 1, input.size(), in);
+        std::fflush(in);
+        std::rewind(in);
+        serve_stream(fileno(in), fileno(out), dispatcher);
+
+        std::rewind(out);
+        std::vector<msgpack::object_handle> responses;
+        std::array<unsigned char, 4> length_bytes{};
+        while (std::fread(length_bytes.data(), 1, 4, out) == 4) {
+            const uint32_t length = static_cast<uint32_t>(length_bytes[0]) |
+                                    (static_cast<uint32_t>(length_bytes[1]) << 8) |
+                                    (static_cast<uint32_t>(length_bytes[2]) << 16) |
+                                    (static_cast<uint32_t>(length_bytes[3]) << 24);
+            std::vector<char> frame(length);
+            EXPECT_EQ(std::fread(frame.data(), 1, length, out), length);
+            responses.push_back(msgpack::unpack(frame.data(), length));
+        }
+        std::fclose(in);
+        std::fclose(out);
+        return responses;
+    }
+
+    static HeaderOnlyMessage header_of(const msgpack::object_handle& response)
+    {
+        HeaderOnlyMessage header;
+        response.get().convert(header);
+        return header;
+    }
+
+    static ServerResponse response_of(const msgpack::object_handle& response)
+    {
+        TypedMessage<ServerResponse> message;
+        response.get().convert(message);
+        return message.value;
+    }
+};
+
+} // namespace
+
+TEST_F(ServerStreamTest, RequestsAreAnsweredInOrder)
+{
+    add_ping(1);
+    add_echo(2, "hello");
+    add_echo(3, "");
+    auto responses = serve();
+    ASSERT_EQ(responses.size(), 3UL);
+
+    EXPECT_EQ(header_of(responses[0]).msgType, static_cast<uint32_t>(SystemMsgTypes::PONG));
+    EXPECT_EQ(header_of(responses[0]).header.requestId, 1U);
+
+    EXPECT_EQ(header_of(responses[1]).header.requestId, 2U);
+    EXPECT_TRUE(response_of(responses[1]).success);
+
+    // A handler that throws produces an unsuccessful response
+    EXPECT_EQ(header_of(responses[2]).header.requestId, 3U);
+    EXPECT_FALSE(response_of(responses[2]).success);
+    EXPECT_EQ(response_of(responses[2]).error, "empty");
+}
+
+TEST_F(ServerStreamTest, TerminateStopsServing)
+{
+    add_ping(1);
+    MsgHeader header(2, 0);
+    add_frame(HeaderOnlyMessage(SystemMsgTypes::TERMINATE, header));
+    add_ping(3);
+    auto responses = serve();
+    ASSERT_EQ(responses.size(), 1UL);
+    EXPECT_EQ(header_of(responses[0]).header.requestId, 1U);
+}
+
+TEST_F(ServerStreamTest, MalformedFramesAreAnsweredAndSkipped)
+{
+    // Not msgpack at all
+    add_raw_frame(4, std::string("\xc1\xc1\xc1\xc1", 4));
+    // A valid header of an unknown message type
+    MsgHeader unknown_header(2, 0);
+    add_frame(HeaderOnlyMessage(FIRST_APP_MSG_TYPE + 1, unknown_header));
+    // A valid header whose request body has the wrong shape
+    MsgHeader bad_body_header(3, 0);
+    add_frame(HeaderOnlyMessage(ECHO, bad_body_header));
+    // An empty frame
+    add_raw_frame(0, "");
+    add_ping(5);
+    auto responses = serve();
+    ASSERT_EQ(responses.size(), 5UL);
+
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_FALSE(response_of(responses[i]).success);
+        EXPECT_FALSE(response_of(responses[i]).error.empty());
+    }
+    EXPECT_EQ(header_of(responses[1]).header.requestId, 2U);
+    EXPECT_EQ(header_of(responses[2]).header.requestId, 3U);
+    EXPECT_EQ(header_of(responses[4]).msgType, static_cast<uint32_t>(SystemMsgTypes::PONG));
+    EXPECT_EQ(header_of(responses[4]).header.requestId, 5U);
+}
+
+TEST_F(ServerStreamTest, OversizedFrameIsSkipped)
+{
+    add_raw_frame(MAX_FRAME_SIZE + 1, std::string(MAX_FRAME_SIZE + 1, 'x'));
+    add_ping(2);
+    auto responses = serve();
+    ASSERT_EQ(responses.size(), 2UL);
+    EXPECT_FALSE(response_of(responses[0]).success);
+    EXPECT_EQ(header_of(responses[1]).msgType, static_cast<uint32_t>(SystemMsgTypes::PONG));
+}
+
+TEST_F(ServerStreamTest, TruncatedFrameThrows)
+{
+    add_ping(1);
+    add_raw_frame(100, "too short");
+    EXPECT_THROW(serve(), std::runtime_error);
+}
+
+TEST(ServerSocketTest, DisconnectedClientDoesNotRaiseSigpipe)
+{
+    // Fail loudly rather than being killed if a response still raises SIGPIPE
+    auto* previous_handler = std::signal(SIGPIPE, [](int) { std::abort(); });
+
+    std::array<int, 2> fds{};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()), 0);
+    std::string ping;
+    {
+        msgpack::sbuffer buffer;
+        MsgHeader header(1, 0);
+        msgpack::pack(buffer, HeaderOnlyMessage(SystemMsgTypes::PING, header));
+        const auto length = static_cast<uint32_t>(buffer.size());
+        for (size_t i = 0; i < 4; i++) {
+            ping.push_back(static_cast<char>((length >> (8 * i)) & 0xff));
+        }
+        ping.append(buffer.data(), buffer.size());
+    }
+    // The client sends its request and hangs up before reading the response
+    ASSERT_EQ(::write(fds[1], ping.data(), ping.size()), static_cast<ssize_t>(ping.size()));
+    ::close(fds[1]);
+
+    MessageDispatcher dispatcher;
+    EXPECT_THROW(serve_stream(fds[0], fds[0], dispatcher), std::runtime_error);
+    ::close(fds[0]);
+    std::signal(SIGPIPE, previous_handler);
+}
@@ -44,7 +44,7 @@ template <typename TreeType> void commit_tree(TreeType& tree)
     signal.wait_for_level(0);
 }
 
-template <typename TreeType> void append_only_tree_bench(State& state) noexcept
+template <typename TreeType> void append_only_tree_bench(State& state, uint32_t num_threads) noexcept
 {
     const size_t batch_size = size_t(state.range(0));
     const size_t depth = TREE_DEPTH;
@@ -52,7 +52,6 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
     std::string directory = random_temp_directory();
     std::string name = random_string();
     std::filesystem::create_directories(directory);
-    uint32_t num_threads = 16;
 
     LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
     std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
@@ -71,6 +70,21 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
 
     std::filesystem::remove_all(directory);
 }
+
+template <typename TreeType> void append_only_tree_bench(State& state) noexcept
+{
+    append_only_tree_bench<TreeType>(state, 16);
+}
+
+/**
+ * @brief Appends a batch of range(0) leaves on a tree whose thread pool has range(1) threads. Subtree levels are hashed
+ * across the pool, so large batches should scale with the thread count.
+ */
+template <typename TreeType> void append_only_tree_thread_scaling_bench(State& state) noexcept
+{
+    append_only_tree_bench<TreeType>(state, static_cast<uint32_t>(state.range(1)));
+}
+
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -81,6 +95,12 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->RangeMultiplier(2)
     ->Range(512, 8192)
     ->Iterations(10);
+BENCHMARK(append_only_tree_thread_scaling_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 1024, 8192 }, { 1, 2, 4, 8, 16 } })
+    ->ArgNames({ "batch", "threads" })
+    ->Iterations(10)
+    ->UseRealTime();
 
 } // namespace
 
@@ -40,7 +40,28 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+/**
+ * @brief Builder bookkeeping over 2^state.range(0) witnesses: constant lookups, range lists and tag assignment
+ * @details state.range(1) selects whether the builder is given a size hint up front.
+ */
+void bookkeeping_construction_bench(State& state)
+{
+    const size_t num_witnesses = 1UL << static_cast<size_t>(state.range(0));
+    const size_t size_hint = state.range(1) != 0 ? num_witnesses : 0;
+    for (auto _ : state) {
+        UltraCircuitBuilder builder(size_hint);
+        for (size_t i = 0; i < num_witnesses; ++i) {
+            const uint32_t witness_index = builder.add_variable(fr(i & 1));
+            builder.create_new_range_constraint(witness_index, (1ULL << (1 + (i % 14))) - 1);
+            DoNotOptimize(builder.put_constant_variable(fr(i % 1024)));
+        }
+        builder.finalize_circuit(/*ensure_nonzero=*/false);
+        DoNotOptimize(builder.get_num_variables());
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(bookkeeping_construction_bench)->Unit(kMillisecond)->ArgsProduct({ { 14, 16, 18 }, { 0, 1 } });
 
 BENCHMARK_MAIN();
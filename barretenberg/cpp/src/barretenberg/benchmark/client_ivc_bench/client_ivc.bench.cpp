@@ -4,6 +4,7 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <limits>
 
 #include "barretenberg/client_ivc/test_bench_shared.hpp"
 #include "barretenberg/common/op_count_google_bench.hpp"
@@ -45,9 +46,29 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Full)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol with pipelined accumulation, in which each fold
+ * runs in the background while the next circuit and its proving key are constructed
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullPipelined)(benchmark::State& state)
+{
+    ClientIVC ivc;
+    ivc.trace_settings.structure = TraceStructure::CLIENT_IVC_BENCH;
+    ivc.pipeline_memory_budget = std::numeric_limits<size_t>::max();
+    auto total_num_circuits = 2 * static_cast<size_t>(state.range(0)); // 2x accounts for kernel circuits
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_ivc_accumulation_rounds(total_num_circuits, ivc, mocked_vkeys, /* mock_vk */ true);
+        ivc.prove();
+    }
+}
+
 #define ARGS Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)->Arg(2)
 
 BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, FullPipelined)->Unit(benchmark::kMillisecond)->ARGS;
 
 } // namespace
 
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/translator_vm/translator_circuit_builder.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+using Builder = TranslatorCircuitBuilder;
+
+namespace {
+
+std::shared_ptr<ECCOpQueue> generate_op_queue(size_t num_ops)
+{
+    std::shared_ptr<ECCOpQueue> op_queue = std::make_shared<ECCOpQueue>();
+    using G1 = curve::BN254::AffineElement;
+    using Fr = curve::BN254::ScalarField;
+
+    G1 a = G1::random_element();
+    G1 b = G1::random_element();
+    Fr x = Fr::random_element();
+
+    // Each loop adds 3 ops
+    for (size_t i = 0; i < num_ops / 3; i++) {
+        op_queue->add_accumulate(a);
+        op_queue->mul_accumulate(b, x);
+        op_queue->eq_and_reset();
+    }
+    return op_queue;
+}
+
+/**
+ * @brief Construct the Translator circuit from an op queue with 2^state.range(0) ops
+ */
+void translator_construct_circuit(State& state) noexcept
+{
+    const size_t num_ops = 1UL << static_cast<size_t>(state.range(0));
+    auto op_queue = generate_op_queue(num_ops);
+    const auto batching_challenge_v = fq::random_element();
+    const auto evaluation_input_x = fq::random_element();
+    for (auto _ : state) {
+        Builder builder{ batching_challenge_v, evaluation_input_x, op_queue };
+        DoNotOptimize(builder.num_gates);
+    }
+    state.counters["ops"] =
+        Counter(static_cast<double>(op_queue->get_raw_ops().size() * static_cast<size_t>(state.iterations())),
+                Counter::kIsRate);
+}
+
+BENCHMARK(translator_construct_circuit)->Unit(kMillisecond)->DenseRange(10, 16, 2);
+} // namespace
+
+BENCHMARK_MAIN();
@@ -66,6 +66,51 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+constexpr size_t MAX_BATCH_SIZE_LOG2 = 4;
+constexpr size_t NUM_DISTINCT_BATCH_PROOFS = 4;
+
+/**
+ * @brief Verify state.range(0) proofs of the largest size with a single batch verification, reporting the number of
+ * verified proofs per second (compare with ipa_verify at MAX_POLYNOMIAL_DEGREE_LOG2)
+ */
+void ipa_batch_verify(State& state) noexcept
+{
+    static std::vector<std::shared_ptr<NativeTranscript>> batch_prover_transcripts;
+    static std::vector<OpeningClaim<Curve>> batch_opening_claims;
+    if (batch_prover_transcripts.empty()) {
+        numeric::RNG& engine = numeric::get_debug_randomness();
+        const size_t n = 1 << MAX_POLYNOMIAL_DEGREE_LOG2;
+        for (size_t j = 0; j < NUM_DISTINCT_BATCH_PROOFS; ++j) {
+            Polynomial poly(n);
+            for (size_t i = 0; i < n; ++i) {
+                poly.at(i) = Fr::random_element(&engine);
+            }
+            auto x = Fr::random_element(&engine);
+            const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+            batch_opening_claims.push_back({ opening_pair, ck->commit(poly) });
+            batch_prover_transcripts.push_back(std::make_shared<NativeTranscript>());
+            IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, batch_prover_transcripts.back());
+        }
+    }
+
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<OpeningClaim<Curve>> opening_claims;
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (size_t j = 0; j < batch_size; ++j) {
+            opening_claims.push_back(batch_opening_claims[j % NUM_DISTINCT_BATCH_PROOFS]);
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>(
+                batch_prover_transcripts[j % NUM_DISTINCT_BATCH_PROOFS]->proof_data));
+        }
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify(vk, opening_claims, verifier_transcripts);
+        ASSERT(result);
+    }
+    state.counters["verifications"] =
+        Counter(static_cast<double>(batch_size * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +120,9 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_batch_verify)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << MAX_BATCH_SIZE_LOG2)
+    ->Setup(DoSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
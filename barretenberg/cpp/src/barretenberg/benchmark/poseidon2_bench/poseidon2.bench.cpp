@@ -41,4 +41,66 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+using Permutation = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+
+// Hash state.range(0) pairs one at a time, as a baseline for the batched hash_pairs
+void poseidon2_hash_pair_loop_bench(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<fr> inputs(num_pairs * 2);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_pairs);
+    for (auto _ : state) {
+        for (size_t i = 0; i < num_pairs; ++i) {
+            outputs[i] = Poseidon2::hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.counters["hashes"] =
+        Counter(static_cast<double>(num_pairs * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+BENCHMARK(poseidon2_hash_pair_loop_bench)->RangeMultiplier(16)->Range(1 << 4, 1 << 12);
+
+// Hash state.range(0) pairs with hash_pairs, which runs the multi-lane permutation
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    const auto num_pairs = static_cast<size_t>(state.range(0));
+    std::vector<fr> inputs(num_pairs * 2);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_pairs);
+    for (auto _ : state) {
+        Poseidon2::hash_pairs(inputs, outputs);
+        DoNotOptimize(outputs.data());
+    }
+    state.counters["hashes"] =
+        Counter(static_cast<double>(num_pairs * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+BENCHMARK(poseidon2_hash_pairs_bench)->RangeMultiplier(16)->Range(1 << 4, 1 << 12);
+
+// Permute NUM_LANES independent states at once
+template <size_t NUM_LANES> void poseidon2_permutation_lanes_bench(State& state) noexcept
+{
+    std::array<Permutation::State, NUM_LANES> states;
+    for (auto& lane : states) {
+        for (auto& element : lane) {
+            element = fr::random_element();
+        }
+    }
+    for (auto _ : state) {
+        Permutation::permutation_lanes(states);
+        DoNotOptimize(states.data());
+    }
+    state.counters["permutations"] =
+        Counter(static_cast<double>(NUM_LANES * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+BENCHMARK(poseidon2_permutation_lanes_bench<1>);
+BENCHMARK(poseidon2_permutation_lanes_bench<2>);
+BENCHMARK(poseidon2_permutation_lanes_bench<4>);
+BENCHMARK(poseidon2_permutation_lanes_bench<8>);
+
 BENCHMARK_MAIN();
\ No newline at end of file
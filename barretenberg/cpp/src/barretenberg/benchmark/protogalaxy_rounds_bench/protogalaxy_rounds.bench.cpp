@@ -5,12 +5,38 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/decider_keys.hpp"
 
+#include <fstream>
+#include <string>
+
 using namespace benchmark;
 
 namespace bb {
 
 using Flavor = MegaFlavor;
 
+/**
+ * @brief Read a memory statistic (in KB) from /proc/self/status, e.g. "VmRSS" or "VmHWM" (peak RSS); 0 if unavailable
+ */
+size_t read_memory_status_kb(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with(field + ":")) {
+            return std::stoul(line.substr(field.size() + 1));
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Reset the peak RSS of the process to its current RSS (Linux only, ignored elsewhere)
+ */
+void reset_peak_memory()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
 void _bench_round(::benchmark::State& state, void (*F)(ProtogalaxyProver_<DeciderProvingKeys_<Flavor, 2>>&))
 {
     using Builder = typename Flavor::CircuitBuilder;
@@ -42,9 +68,15 @@ void _bench_round(::benchmark::State& state, void (*F)(ProtogalaxyProver_<Decide
     folding_prover.transcript = Flavor::Transcript::prover_init_empty();
     folding_prover.run_oink_prover_on_each_incomplete_key();
 
+    // Report the peak memory allocated by the round on top of the prover state
+    const size_t memory_before_kb = read_memory_status_kb("VmRSS");
+    reset_peak_memory();
     for (auto _ : state) {
         F(folding_prover);
     }
+    const size_t peak_memory_kb = read_memory_status_kb("VmHWM");
+    state.counters["peak_memory_delta_MiB"] =
+        static_cast<double>(peak_memory_kb > memory_before_kb ? peak_memory_kb - memory_before_kb : 0) / 1024;
 }
 
 void bench_round_mega(::benchmark::State& state, void (*F)(ProtogalaxyProver_<DeciderProvingKeys_<MegaFlavor, 2>>&))
@@ -56,6 +88,18 @@ BENCHMARK_CAPTURE(bench_round_mega, oink, [](auto& prover) { prover.run_oink_pro
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 BENCHMARK_CAPTURE(bench_round_mega, perturbator, [](auto& prover) { prover.perturbator_round(prover.accumulator); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
+// The perturbator computed from row evaluations stored for the whole trace, to compare against the fused computation
+BENCHMARK_CAPTURE(bench_round_mega, perturbator_stored_row_evaluations, [](auto& prover) {
+    const auto& accumulator = prover.accumulator;
+    const size_t log_circuit_size = accumulator->proving_key.log_circuit_size;
+    const auto deltas = compute_round_challenge_pows(log_circuit_size, Flavor::FF::random_element());
+    auto row_evaluations = prover.pg_internal.compute_row_evaluations(
+        accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
+    DoNotOptimize(prover.pg_internal.construct_perturbator_coefficients(
+        std::span{ accumulator->gate_challenges.data(), log_circuit_size },
+        std::span{ deltas.data(), log_circuit_size },
+        row_evaluations));
+}) -> DenseRange(14, 20) -> Unit(kMillisecond);
 BENCHMARK_CAPTURE(bench_round_mega, combiner_quotient, [](auto& prover) {
     prover.combiner_quotient_round(prover.accumulator->gate_challenges, prover.deltas, prover.keys_to_fold);
 }) -> DenseRange(14, 20) -> Unit(kMillisecond);
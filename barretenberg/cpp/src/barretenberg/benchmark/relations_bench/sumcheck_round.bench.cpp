@@ -0,0 +1,64 @@
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include <benchmark/benchmark.h>
+
+namespace {
+auto& engine = bb::numeric::get_debug_randomness();
+}
+
+namespace bb::benchmark::relations {
+
+/**
+ * @brief Time one sumcheck prover round over 2^state.range(0) rows, reporting the edges processed per second
+ * @details The polynomials are random except that the last state.range(1) percent of the rows are all zero, like the
+ * unused part of a structured trace, so that the cost of inactive rows shows up in the throughput.
+ */
+template <typename Flavor> void compute_round_univariate(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using RelationSeparator = typename Flavor::RelationSeparator;
+
+    const auto log_circuit_size = static_cast<size_t>(state.range(0));
+    const size_t circuit_size = size_t(1) << log_circuit_size;
+    const size_t active_rows = circuit_size - circuit_size * static_cast<size_t>(state.range(1)) / 100;
+
+    ProverPolynomials polynomials;
+    for (auto& poly : polynomials.get_all()) {
+        poly = Polynomial<FF>(active_rows, circuit_size);
+        for (auto& coeff : poly.coeffs()) {
+            coeff = FF::random_element(&engine);
+        }
+    }
+
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element(&engine);
+    }
+    std::vector<FF> gate_challenges(log_circuit_size);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element(&engine);
+    }
+    GateSeparatorPolynomial<FF> gate_separators(gate_challenges, log_circuit_size);
+
+    SumcheckProverRound<Flavor> round(circuit_size);
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(round.compute_univariate(
+            0, polynomials, relation_parameters, gate_separators, alpha, ZKSumcheckData<Flavor>()));
+    }
+    state.counters["edges/s"] = ::benchmark::Counter(
+        static_cast<double>(static_cast<size_t>(state.iterations()) * circuit_size / 2), ::benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(compute_round_univariate<UltraFlavor>)
+    ->ArgsProduct({ { 14, 16, 18 }, { 0, 50, 90 } })
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK(compute_round_univariate<MegaFlavor>)
+    ->ArgsProduct({ { 14, 16, 18 }, { 0, 50, 90 } })
+    ->Unit(::benchmark::kMillisecond);
+
+} // namespace bb::benchmark::relations
+
+BENCHMARK_MAIN();
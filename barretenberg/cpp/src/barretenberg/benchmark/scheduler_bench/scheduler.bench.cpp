@@ -0,0 +1,97 @@
+/**
+ * @file scheduler.bench.cpp
+ * @brief Benchmarks for the parallel_for scheduler: dispatch overhead, nested fork/join and independent concurrent
+ * callers (e.g. several provers in one process).
+ */
+#include "barretenberg/common/thread.hpp"
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <thread>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+// Small fixed amount of work per iteration so that scheduling costs are visible.
+size_t spin_work(size_t seed, size_t num_steps)
+{
+    size_t acc = seed;
+    for (size_t i = 0; i < num_steps; i++) {
+        acc = acc * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return acc;
+}
+
+constexpr size_t WORK_PER_ITERATION = 1 << 10;
+
+/**
+ * @brief Cost of a single flat parallel_for over 2^k iterations
+ */
+void flat_parallel_for(State& state)
+{
+    const auto num_iterations = static_cast<size_t>(1) << static_cast<size_t>(state.range(0));
+    std::atomic<size_t> sink = 0;
+    for (auto _ : state) {
+        parallel_for(num_iterations, [&](size_t i) {
+            sink.fetch_add(spin_work(i, WORK_PER_ITERATION) & 1, std::memory_order_relaxed);
+        });
+    }
+    DoNotOptimize(sink.load());
+    state.SetItemsProcessed(static_cast<int64_t>(static_cast<size_t>(state.iterations()) * num_iterations));
+}
+
+/**
+ * @brief An outer parallel_for over the cpus, each issuing an inner parallel_for of 2^k iterations. Idle workers
+ * should be able to pick up inner iterations.
+ */
+void nested_parallel_for(State& state)
+{
+    const size_t num_outer = get_num_cpus();
+    const auto num_inner = static_cast<size_t>(1) << static_cast<size_t>(state.range(0));
+    std::atomic<size_t> sink = 0;
+    for (auto _ : state) {
+        parallel_for(num_outer, [&](size_t i) {
+            parallel_for(num_inner, [&](size_t j) {
+                sink.fetch_add(spin_work(i ^ j, WORK_PER_ITERATION) & 1, std::memory_order_relaxed);
+            });
+        });
+    }
+    DoNotOptimize(sink.load());
+    state.SetItemsProcessed(static_cast<int64_t>(static_cast<size_t>(state.iterations()) * num_outer * num_inner));
+}
+
+/**
+ * @brief Several external threads issuing parallel_for_range concurrently, as independent provers would
+ */
+void concurrent_callers(State& state)
+{
+    const auto num_callers = static_cast<size_t>(state.range(0));
+    constexpr size_t NUM_POINTS = 1 << 14;
+    std::atomic<size_t> sink = 0;
+    for (auto _ : state) {
+        std::vector<std::thread> callers;
+        callers.reserve(num_callers);
+        for (size_t c = 0; c < num_callers; c++) {
+            callers.emplace_back([&, c]() {
+                parallel_for_range(NUM_POINTS, [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        sink.fetch_add(spin_work(i + c, WORK_PER_ITERATION / 16) & 1, std::memory_order_relaxed);
+                    }
+                });
+            });
+        }
+        for (auto& caller : callers) {
+            caller.join();
+        }
+    }
+    DoNotOptimize(sink.load());
+    state.SetItemsProcessed(static_cast<int64_t>(static_cast<size_t>(state.iterations()) * num_callers * NUM_POINTS));
+}
+
+} // namespace
+
+BENCHMARK(flat_parallel_for)->Unit(kMicrosecond)->DenseRange(0, 12, 4);
+BENCHMARK(nested_parallel_for)->Unit(kMicrosecond)->DenseRange(0, 8, 2);
+BENCHMARK(concurrent_callers)->Unit(kMicrosecond)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK_MAIN();
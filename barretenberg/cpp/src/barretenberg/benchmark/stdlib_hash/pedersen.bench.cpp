@@ -117,6 +117,52 @@ void native_pedersen_hash_pair_bench(State& state) noexcept
 }
 BENCHMARK(native_pedersen_hash_pair_bench)->Unit(benchmark::kMillisecond)->MinTime(3);
 
+// Baseline for the pair hash above: the same computation with variable-base scalar multiplications
+void native_pedersen_hash_pair_variable_base_bench(State& state) noexcept
+{
+    using Element = grumpkin::g1::element;
+    const auto generators = crypto::generator_data<curve::Grumpkin>::precomputed_generators;
+    std::vector<grumpkin::fq> elements = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    for (auto _ : state) {
+        Element result = Element(crypto::pedersen_hash::length_generator) * grumpkin::fr(2);
+        result += Element(generators[0]) * uint256_t(elements[0]);
+        result += Element(generators[1]) * uint256_t(elements[1]);
+        DoNotOptimize(result.normalize().x);
+    }
+}
+BENCHMARK(native_pedersen_hash_pair_variable_base_bench)->MinTime(3);
+
+// Hash state.range(0) pairs at once, as for a layer of a Merkle tree
+void native_pedersen_hash_batch_bench(State& state) noexcept
+{
+    const auto num_hashes = static_cast<size_t>(state.range(0));
+    std::vector<std::vector<grumpkin::fq>> inputs(num_hashes);
+    for (auto& input : inputs) {
+        input = { grumpkin::fq::random_element(), grumpkin::fq::random_element() };
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_batch(inputs));
+    }
+    state.counters["hashes"] =
+        Counter(static_cast<double>(num_hashes * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+BENCHMARK(native_pedersen_hash_batch_bench)->RangeMultiplier(8)->Range(1 << 6, 1 << 12);
+
+// Hash a buffer of state.range(0) bytes
+void native_pedersen_hash_buffer_bench(State& state) noexcept
+{
+    const auto num_bytes = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> input(num_bytes);
+    for (size_t i = 0; i < num_bytes; ++i) {
+        input[i] = static_cast<uint8_t>(i);
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_hash::hash_buffer(input));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(num_bytes * static_cast<size_t>(state.iterations())));
+}
+BENCHMARK(native_pedersen_hash_buffer_bench)->RangeMultiplier(8)->Range(1 << 6, 1 << 12);
+
 void construct_pedersen_proving_keys_bench(State& state) noexcept
 {
     for (auto _ : state) {
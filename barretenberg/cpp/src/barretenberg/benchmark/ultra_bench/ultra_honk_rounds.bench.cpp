@@ -82,6 +82,22 @@ BB_PROFILE static void test_round(State& state, size_t index) noexcept
     }                                                                                                                  \
     BENCHMARK(ROUND_##round)->DenseRange(12, 19)->Unit(kMillisecond)
 
+/**
+ * @brief Construct the proving key (execution trace, copy cycles and sigma/id polynomials) of a Mega circuit of size
+ * 2^state.range(0)
+ */
+BB_PROFILE static void construct_proving_key(State& state) noexcept
+{
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    MegaCircuitBuilder builder;
+    bb::mock_circuits::generate_basic_arithmetic_circuit(builder, log2_num_gates);
+    for (auto _ : state) {
+        DoNotOptimize(std::make_shared<DeciderProvingKey_<MegaFlavor>>(builder));
+    }
+}
+
 // Fast rounds take a long time to benchmark because of how we compute statistical significance.
 // Limit to one iteration so we don't spend a lot of time redoing full proofs just to measure this part.
 ROUND_BENCHMARK(PREAMBLE)->Iterations(1);
@@ -92,5 +108,6 @@ ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
 ROUND_BENCHMARK(ZEROMORPH);
+BENCHMARK(construct_proving_key)->DenseRange(16, 19)->Unit(kMillisecond);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/batch_verifier.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+constexpr size_t LOG_NUM_GATES = 12;
+
+struct ProofsAndKeys {
+    std::vector<std::shared_ptr<UltraFlavor::VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+};
+
+ProofsAndKeys construct_proofs(size_t num_proofs)
+{
+    bb::srs::init_crs_factory("../srs_db/ignition");
+    ProofsAndKeys result;
+    for (size_t i = 0; i < num_proofs; i++) {
+        UltraCircuitBuilder builder;
+        bb::mock_circuits::generate_basic_arithmetic_circuit(builder, LOG_NUM_GATES);
+        auto proving_key = std::make_shared<DeciderProvingKey_<UltraFlavor>>(builder);
+        UltraProver prover(proving_key);
+        result.verification_keys.emplace_back(
+            std::make_shared<UltraFlavor::VerificationKey>(proving_key->proving_key));
+        result.proofs.emplace_back(prover.construct_proof());
+    }
+    return result;
+}
+
+/**
+ * @brief Benchmark: Verify state.range(0) Ultra Honk proofs one at a time, one pairing per proof
+ */
+void verify_individually(State& state) noexcept
+{
+    const auto [verification_keys, proofs] = construct_proofs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < proofs.size(); i++) {
+            UltraVerifier verifier(verification_keys[i]);
+            DoNotOptimize(verifier.verify_proof(proofs[i]));
+        }
+    }
+    state.counters["proofs"] =
+        Counter(static_cast<double>(proofs.size() * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+
+/**
+ * @brief Benchmark: Verify state.range(0) Ultra Honk proofs as a batch, with a single pairing
+ */
+void verify_batch(State& state) noexcept
+{
+    const auto [verification_keys, proofs] = construct_proofs(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        DoNotOptimize(UltraBatchVerifier::verify(verification_keys, proofs));
+    }
+    state.counters["proofs"] =
+        Counter(static_cast<double>(proofs.size() * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+
+} // namespace
+
+BENCHMARK(verify_individually)->RangeMultiplier(4)->Range(1, 64)->Unit(kMillisecond);
+BENCHMARK(verify_batch)->RangeMultiplier(4)->Range(1, 64)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,14 +1,58 @@
 #include "graph.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <algorithm>
-#include <stack>
+#include <atomic>
+#include <numeric>
 
 using namespace bb::plookup;
 using namespace bb;
 
+namespace {
+
+// rough cost in nanoseconds of collecting the variables and edges of one gate, dominated by allocating its vectors
+constexpr size_t GATE_PROCESSING_COST = 200;
+
+// tables used in read_from_1_to_2_table by the AES gadget
+bool is_aes_plookup_table(BasicTableId table_id)
+{
+    switch (table_id) {
+    case BasicTableId::AES_SBOX_MAP:
+    case BasicTableId::AES_SPARSE_MAP:
+    case BasicTableId::AES_SPARSE_NORMALIZE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// tables used in read_from_1_to_2_table by the sha256 gadget
+bool is_sha256_plookup_table(BasicTableId table_id)
+{
+    switch (table_id) {
+    case BasicTableId::SHA256_WITNESS_SLICE_3:
+    case BasicTableId::SHA256_WITNESS_SLICE_7_ROTATE_4:
+    case BasicTableId::SHA256_WITNESS_SLICE_8_ROTATE_7:
+    case BasicTableId::SHA256_WITNESS_SLICE_14_ROTATE_1:
+    case BasicTableId::SHA256_BASE16:
+    case BasicTableId::SHA256_BASE16_ROTATE2:
+    case BasicTableId::SHA256_BASE16_ROTATE6:
+    case BasicTableId::SHA256_BASE16_ROTATE7:
+    case BasicTableId::SHA256_BASE16_ROTATE8:
+    case BasicTableId::SHA256_BASE28:
+    case BasicTableId::SHA256_BASE28_ROTATE3:
+    case BasicTableId::SHA256_BASE28_ROTATE6:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 /**
- * @brief this method removes duplicate variables from a gate,
- * converts variables from a gate to real variables, and then
- * updates variable gates count for real variable indexes
+ * @brief this method removes duplicate variables from a gate and
+ * converts variables from a gate to real variables. the gates count of the variables
+ * is updated by the caller
  */
 
 template <typename FF>
@@ -23,9 +67,6 @@ inline void Graph_<FF>::process_gate_variables(UltraCircuitBuilder& ultra_circui
     for (size_t i = 0; i < gate_variables.size(); i++) {
         gate_variables[i] = this->to_real(ultra_circuit_builder, gate_variables[i]);
     }
-    for (const auto& variable_index : gate_variables) {
-        variables_gate_counts[variable_index] += 1;
-    }
 }
 
 /**
@@ -197,6 +238,91 @@ inline std::vector<uint32_t> Graph_<FF>::get_plookup_gate_connected_component(
     return gate_variables;
 }
 
+/**
+ * @brief this method collects the variables and edges of the gates [0, num_gates) of a block in parallel. it counts
+ * the gates using every variable and appends the edges between the variables of every gate to edges
+ * @tparam FF
+ * @param ultra_circuit_builder
+ * @param num_gates
+ * @param get_gate_variables returns the real variables of the gate with a given index
+ * @param edges
+ */
+
+template <typename FF>
+template <typename GateVariablesFunction>
+void Graph_<FF>::process_gates(bb::UltraCircuitBuilder& ultra_circuit_builder,
+                               size_t num_gates,
+                               const GateVariablesFunction& get_gate_variables,
+                               std::vector<std::pair<uint32_t, uint32_t>>& edges)
+{
+    struct GatesChunk {
+        std::vector<uint32_t> variables; // one entry per gate using a variable
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+    };
+    const auto chunks = parallel_for_heuristic(
+        num_gates,
+        GatesChunk{},
+        [&](size_t gate_index, GatesChunk& chunk) {
+            std::vector<uint32_t> gate_variables = get_gate_variables(gate_index);
+            chunk.variables.insert(chunk.variables.end(), gate_variables.begin(), gate_variables.end());
+            this->connect_all_variables_in_vector(ultra_circuit_builder, gate_variables, false, chunk.edges);
+        },
+        GATE_PROCESSING_COST);
+    for (const auto& chunk : chunks) {
+        for (const auto& variable_index : chunk.variables) {
+            variables_gate_counts[variable_index] += 1;
+        }
+        edges.insert(edges.end(), chunk.edges.begin(), chunk.edges.end());
+    }
+}
+
+/**
+ * @brief this method builds the adjacency of the graph in CSR form from a list of edges. every edge (a, b) makes b a
+ * neighbour of a and a a neighbour of b. the neighbours of every variable are sorted, so the result doesn't depend on
+ * the number of threads
+ * @tparam FF
+ * @param edges
+ */
+
+template <typename FF> void Graph_<FF>::construct_adjacency(const std::vector<std::pair<uint32_t, uint32_t>>& edges)
+{
+    const size_t num_variables = variables_gate_counts.size();
+    std::vector<std::atomic<uint32_t>> degrees(num_variables);
+    parallel_for_heuristic(
+        edges.size(),
+        [&](size_t edge_index) {
+            degrees[edges[edge_index].first].fetch_add(1, std::memory_order_relaxed);
+            degrees[edges[edge_index].second].fetch_add(1, std::memory_order_relaxed);
+        },
+        thread_heuristics::FF_COPY_COST);
+
+    // compute the start of every adjacency list, then reuse the degrees as cursors to the next free slot in every list
+    adjacency_offsets.resize(num_variables + 1);
+    adjacency_offsets[0] = 0;
+    for (size_t variable_index = 0; variable_index < num_variables; variable_index++) {
+        const uint32_t degree = degrees[variable_index].load(std::memory_order_relaxed);
+        adjacency_offsets[variable_index + 1] = adjacency_offsets[variable_index] + degree;
+        degrees[variable_index].store(adjacency_offsets[variable_index], std::memory_order_relaxed);
+    }
+    adjacency.resize(adjacency_offsets[num_variables]);
+
+    parallel_for_heuristic(
+        edges.size(),
+        [&](size_t edge_index) {
+            const auto [first_variable_index, second_variable_index] = edges[edge_index];
+            adjacency[degrees[first_variable_index].fetch_add(1, std::memory_order_relaxed)] = second_variable_index;
+            adjacency[degrees[second_variable_index].fetch_add(1, std::memory_order_relaxed)] = first_variable_index;
+        },
+        thread_heuristics::FF_COPY_COST);
+    parallel_for_heuristic(
+        num_variables,
+        [&](size_t variable_index) {
+            std::sort(adjacency.begin() + adjacency_offsets[variable_index],
+                      adjacency.begin() + adjacency_offsets[variable_index + 1]);
+        },
+        thread_heuristics::FF_COPY_COST);
+}
+
 /**
  * @brief Construct a new Graph from Ultra Circuit Builder
  * @tparam FF
@@ -205,63 +331,49 @@ inline std::vector<uint32_t> Graph_<FF>::get_plookup_gate_connected_component(
 
 template <typename FF> Graph_<FF>::Graph_(bb::UltraCircuitBuilder& ultra_circuit_constructor)
 {
-    this->variables_gate_counts =
-        std::unordered_map<uint32_t, size_t>(ultra_circuit_constructor.real_variable_index.size());
-    this->variable_adjacency_lists =
-        std::unordered_map<uint32_t, std::vector<uint32_t>>(ultra_circuit_constructor.real_variable_index.size());
-    this->variables_degree = std::unordered_map<uint32_t, size_t>(ultra_circuit_constructor.real_variable_index.size());
-    for (const auto& variable_index : ultra_circuit_constructor.real_variable_index) {
-        variables_gate_counts[variable_index] = 0;
-        variables_degree[variable_index] = 0;
-        variable_adjacency_lists[variable_index] = {};
-    }
-
-    std::map<FF, uint32_t> constant_variable_indices = ultra_circuit_constructor.constant_variable_indices;
-    const auto& arithmetic_block = ultra_circuit_constructor.blocks.arithmetic;
-    auto arithmetic_gates_numbers = arithmetic_block.size();
-    bool arithmetic_gates_exist = arithmetic_gates_numbers > 0;
-    if (arithmetic_gates_exist) {
-        for (size_t i = 0; i < arithmetic_gates_numbers; i++) {
-            auto gate_variables = this->get_arithmetic_gate_connected_component(ultra_circuit_constructor, i);
-            this->connect_all_variables_in_vector(ultra_circuit_constructor, gate_variables, false);
-        }
-    }
-    const auto& elliptic_block = ultra_circuit_constructor.blocks.elliptic;
-    auto elliptic_gates_numbers = elliptic_block.size();
-    bool elliptic_gates_exist = elliptic_gates_numbers > 0;
-    if (elliptic_gates_exist) {
-        for (size_t i = 0; i < elliptic_gates_numbers; i++) {
-            std::vector<uint32_t> gate_variables =
-                this->get_elliptic_gate_connected_component(ultra_circuit_constructor, i);
-            this->connect_all_variables_in_vector(ultra_circuit_constructor, gate_variables, false);
-        }
+    const size_t num_variables = ultra_circuit_constructor.real_variable_index.size();
+    this->variables_gate_counts = std::vector<size_t>(num_variables, 0);
+    this->constant_variables = std::vector<bool>(num_variables, false);
+    for (const auto& pair : ultra_circuit_constructor.constant_variable_indices) {
+        constant_variables[pair.second] = true;
     }
+
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    this->process_gates(
+        ultra_circuit_constructor,
+        ultra_circuit_constructor.blocks.arithmetic.size(),
+        [&](size_t i) { return this->get_arithmetic_gate_connected_component(ultra_circuit_constructor, i); },
+        edges);
+    this->process_gates(
+        ultra_circuit_constructor,
+        ultra_circuit_constructor.blocks.elliptic.size(),
+        [&](size_t i) { return this->get_elliptic_gate_connected_component(ultra_circuit_constructor, i); },
+        edges);
+
+    // the variables of consecutive sort gates form one chain, which is ended by a gate without a sort constraint, so
+    // this block is processed sequentially
     const auto& range_block = ultra_circuit_constructor.blocks.delta_range;
-    auto range_gates = range_block.size();
-    bool range_gates_exists = range_gates > 0;
-    if (range_gates_exists) {
-        std::vector<uint32_t> sorted_variables;
-        for (size_t i = 0; i < range_gates; i++) {
-            auto current_gate = this->get_sort_constraint_connected_component(ultra_circuit_constructor, i);
-            if (current_gate.empty()) {
-                this->connect_all_variables_in_vector(ultra_circuit_constructor, sorted_variables, true);
-                sorted_variables.clear();
-            } else {
-                sorted_variables.insert(sorted_variables.end(), current_gate.begin(), current_gate.end());
-            }
+    std::vector<uint32_t> sorted_variables;
+    for (size_t i = 0; i < range_block.size(); i++) {
+        auto current_gate = this->get_sort_constraint_connected_component(ultra_circuit_constructor, i);
+        for (const auto& variable_index : current_gate) {
+            variables_gate_counts[variable_index] += 1;
         }
-    }
-
-    const auto& lookup_block = ultra_circuit_constructor.blocks.lookup;
-    auto lookup_gates = lookup_block.size();
-    bool lookup_gates_exists = lookup_gates > 0;
-    if (lookup_gates_exists) {
-        for (size_t i = 0; i < lookup_gates; i++) {
-            std::vector<uint32_t> variable_indices =
-                this->get_plookup_gate_connected_component(ultra_circuit_constructor, i);
-            this->connect_all_variables_in_vector(ultra_circuit_constructor, variable_indices, false);
+        if (current_gate.empty()) {
+            this->connect_all_variables_in_vector(ultra_circuit_constructor, sorted_variables, true, edges);
+            sorted_variables.clear();
+        } else {
+            sorted_variables.insert(sorted_variables.end(), current_gate.begin(), current_gate.end());
         }
     }
+
+    this->process_gates(
+        ultra_circuit_constructor,
+        ultra_circuit_constructor.blocks.lookup.size(),
+        [&](size_t i) { return this->get_plookup_gate_connected_component(ultra_circuit_constructor, i); },
+        edges);
+
+    this->construct_adjacency(edges);
 }
 
 /**
@@ -277,15 +389,7 @@ template <typename FF>
 bool Graph_<FF>::check_is_not_constant_variable(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                 const uint32_t& variable_index)
 {
-    bool is_not_constant = true;
-    auto constant_variable_indices = ultra_circuit_builder.constant_variable_indices;
-    for (const auto& pair : constant_variable_indices) {
-        if (pair.second == ultra_circuit_builder.real_variable_index[variable_index]) {
-            is_not_constant = false;
-            break;
-        }
-    }
-    return is_not_constant;
+    return !constant_variables[ultra_circuit_builder.real_variable_index[variable_index]];
 }
 
 /**
@@ -295,12 +399,14 @@ bool Graph_<FF>::check_is_not_constant_variable(bb::UltraCircuitBuilder& ultra_c
  * @param ultra_circuit_builder
  * @param variables_vector
  * @param is_sorted_variables
+ * @param edges the list of edges to append the connections to
  */
 
 template <typename FF>
 void Graph_<FF>::connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                  const std::vector<uint32_t>& variables_vector,
-                                                 bool is_sorted_variables)
+                                                 bool is_sorted_variables,
+                                                 std::vector<std::pair<uint32_t, uint32_t>>& edges)
 {
     if (variables_vector.empty()) {
         return;
@@ -316,7 +422,7 @@ void Graph_<FF>::connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_
                     bool second_variable_is_not_constant =
                         this->check_is_not_constant_variable(ultra_circuit_builder, variables_vector[i + 1]);
                     if (first_variable_is_not_constant && second_variable_is_not_constant) {
-                        this->add_new_edge(variables_vector[i], variables_vector[i + 1]);
+                        edges.emplace_back(variables_vector[i], variables_vector[i + 1]);
                     }
                 }
             }
@@ -333,7 +439,7 @@ void Graph_<FF>::connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_
                     bool second_variable_is_not_constant =
                         this->check_is_not_constant_variable(ultra_circuit_builder, variables_vector[j]);
                     if (first_variable_is_not_constant && second_variable_is_not_constant) {
-                        this->add_new_edge(variables_vector[i], variables_vector[j]);
+                        edges.emplace_back(variables_vector[i], variables_vector[j]);
                     }
                 }
             }
@@ -342,68 +448,51 @@ void Graph_<FF>::connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_
 }
 
 /**
- * @brief this method creates an edge between two variables in graph. All needed checks in a function above
- * @tparam FF
- * @param first_variable_index
- * @param second_variable_index
- */
-
-template <typename FF>
-void Graph_<FF>::add_new_edge(const uint32_t& first_variable_index, const uint32_t& second_variable_index)
-{
-    variable_adjacency_lists[first_variable_index].emplace_back(second_variable_index);
-    variable_adjacency_lists[second_variable_index].emplace_back(first_variable_index);
-    variables_degree[first_variable_index] += 1;
-    variables_degree[second_variable_index] += 1;
-}
-
-/**
- * @brief this method implements depth-first search algorithm for undirected graphs
+ * @brief this methond finds all connected components in the graph described by adjacency lists. it joins the ends of
+ * every edge with a union-find, whose roots are the smallest variables of their components. the components are ordered
+ * by their smallest variable and every component is sorted
  * @tparam FF
- * @param variable_index
- * @param is_used
- * @param connected_component
+ * @return std::vector<std::vector<uint32_t>>
  */
 
-template <typename FF>
-void Graph_<FF>::depth_first_search(const uint32_t& variable_index,
-                                    std::unordered_set<uint32_t>& is_used,
-                                    std::vector<uint32_t>& connected_component)
+template <typename FF> std::vector<std::vector<uint32_t>> Graph_<FF>::find_connected_components()
 {
-    std::stack<uint32_t> variable_stack;
-    variable_stack.push(variable_index);
-    while (!variable_stack.empty()) {
-        uint32_t current_index = variable_stack.top();
-        variable_stack.pop();
-        if (!is_used.contains(current_index)) {
-            is_used.insert(current_index);
-            connected_component.emplace_back(current_index);
-            for (const auto& it : variable_adjacency_lists[current_index]) {
-                variable_stack.push(it);
+    const auto num_variables = static_cast<uint32_t>(variables_gate_counts.size());
+    std::vector<uint32_t> parents(num_variables);
+    std::iota(parents.begin(), parents.end(), 0);
+    auto find_root = [&](uint32_t variable_index) {
+        while (parents[variable_index] != variable_index) {
+            // path halving
+            parents[variable_index] = parents[parents[variable_index]];
+            variable_index = parents[variable_index];
+        }
+        return variable_index;
+    };
+    for (uint32_t variable_index = 0; variable_index < num_variables; variable_index++) {
+        for (const auto& neighbour_index : this->get_variable_adjacency_list(variable_index)) {
+            if (neighbour_index > variable_index) {
+                uint32_t first_root = find_root(variable_index);
+                uint32_t second_root = find_root(neighbour_index);
+                if (first_root != second_root) {
+                    parents[std::max(first_root, second_root)] = std::min(first_root, second_root);
+                }
             }
         }
     }
-}
-
-/**
- * @brief this methond finds all connected components in the graph described by adjacency lists
- * @tparam FF
- * @return std::vector<std::vector<uint32_t>>
- */
 
-template <typename FF> std::vector<std::vector<uint32_t>> Graph_<FF>::find_connected_components()
-{
-    std::unordered_set<uint32_t> is_used;
+    // isolated variables don't form components
     std::vector<std::vector<uint32_t>> connected_components;
-    for (const auto& pair : variable_adjacency_lists) {
-        if (pair.first != 0 && variables_degree[pair.first] > 0) {
-            if (!is_used.contains(pair.first)) {
-                std::vector<uint32_t> connected_component;
-                this->depth_first_search(pair.first, is_used, connected_component);
-                std::sort(connected_component.begin(), connected_component.end());
-                connected_components.emplace_back(connected_component);
-            }
+    std::vector<uint32_t> component_indices(num_variables, UINT32_MAX);
+    for (uint32_t variable_index = 0; variable_index < num_variables; variable_index++) {
+        if (this->get_variable_degree(variable_index) == 0) {
+            continue;
         }
+        uint32_t root = find_root(variable_index);
+        if (component_indices[root] == UINT32_MAX) {
+            component_indices[root] = static_cast<uint32_t>(connected_components.size());
+            connected_components.emplace_back();
+        }
+        connected_components[component_indices[root]].emplace_back(variable_index);
     }
     return connected_components;
 }
@@ -425,7 +514,7 @@ template <typename FF> std::vector<std::vector<uint32_t>> Graph_<FF>::find_conne
 
 template <typename FF>
 inline size_t Graph_<FF>::process_current_decompose_chain(bb::UltraCircuitBuilder& ultra_circuit_constructor,
-                                                          std::unordered_set<uint32_t>& variables_in_one_gate,
+                                                          std::vector<bool>& variables_in_one_gate,
                                                           size_t index)
 {
     auto& arithmetic_block = ultra_circuit_constructor.blocks.arithmetic;
@@ -439,15 +528,15 @@ inline size_t Graph_<FF>::process_current_decompose_chain(bb::UltraCircuitBuilde
         accumulators_indices.emplace_back(this->to_real(ultra_circuit_constructor, fourth_idx));
         auto left_idx = arithmetic_block.w_l()[current_index];
         if (left_idx != zero_idx) {
-            variables_in_one_gate.erase(this->to_real(ultra_circuit_constructor, left_idx));
+            variables_in_one_gate[this->to_real(ultra_circuit_constructor, left_idx)] = false;
         }
         auto right_idx = arithmetic_block.w_r()[current_index];
         if (right_idx != zero_idx) {
-            variables_in_one_gate.erase(this->to_real(ultra_circuit_constructor, right_idx));
+            variables_in_one_gate[this->to_real(ultra_circuit_constructor, right_idx)] = false;
         }
         auto out_idx = arithmetic_block.w_o()[current_index];
         if (out_idx != zero_idx) {
-            variables_in_one_gate.erase(this->to_real(ultra_circuit_constructor, out_idx));
+            variables_in_one_gate[this->to_real(ultra_circuit_constructor, out_idx)] = false;
         }
         auto q_arith = arithmetic_block.q_arith()[current_index];
         if (q_arith == 1 || current_index == arithmetic_block.size() - 1) {
@@ -482,12 +571,12 @@ inline size_t Graph_<FF>::process_current_decompose_chain(bb::UltraCircuitBuilde
 
 template <typename FF>
 inline void Graph_<FF>::remove_unnecessary_decompose_variables(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                                               std::unordered_set<uint32_t>& variables_in_one_gate,
-                                                               const std::unordered_set<uint32_t>& decompose_variables)
+                                                               std::vector<bool>& variables_in_one_gate,
+                                                               const std::vector<bool>& decompose_variables)
 {
     auto is_power_two = [&](const uint256_t& number) { return number > 0 && ((number & (number - 1)) == 0); };
     auto find_position = [&](uint32_t variable_index) {
-        return decompose_variables.contains(this->to_real(ultra_circuit_builder, variable_index));
+        return decompose_variables[this->to_real(ultra_circuit_builder, variable_index)];
     };
     auto& arithmetic_block = ultra_circuit_builder.blocks.arithmetic;
     if (arithmetic_block.size() > 0) {
@@ -534,29 +623,19 @@ inline void Graph_<FF>::remove_unnecessary_decompose_variables(bb::UltraCircuitB
  * @param gate_index
  */
 template <typename FF>
-inline void Graph_<FF>::remove_unnecessary_aes_plookup_variables(std::unordered_set<uint32_t>& variables_in_one_gate,
+inline void Graph_<FF>::remove_unnecessary_aes_plookup_variables(std::vector<bool>& variables_in_one_gate,
                                                                  UltraCircuitBuilder& ultra_circuit_builder,
                                                                  BasicTableId& table_id,
                                                                  size_t gate_index)
 {
-
-    auto find_position = [&](uint32_t real_variable_index) {
-        return variables_in_one_gate.contains(real_variable_index);
-    };
-    std::unordered_set<BasicTableId> aes_plookup_tables{ BasicTableId::AES_SBOX_MAP,
-                                                         BasicTableId::AES_SPARSE_MAP,
-                                                         BasicTableId::AES_SPARSE_NORMALIZE };
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
-    if (aes_plookup_tables.contains(table_id)) {
+    if (is_aes_plookup_table(table_id)) {
         uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
         uint32_t real_right_idx = this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index]);
         if (variables_gate_counts[real_out_idx] != 1 || variables_gate_counts[real_right_idx] != 1) {
-            bool find_out = find_position(real_out_idx);
             auto q_c = lookup_block.q_c()[gate_index];
             if (q_c == 0) {
-                if (find_out) {
-                    variables_in_one_gate.erase(real_out_idx);
-                }
+                variables_in_one_gate[real_out_idx] = false;
             }
         }
     }
@@ -564,7 +643,7 @@ inline void Graph_<FF>::remove_unnecessary_aes_plookup_variables(std::unordered_
 
 /**
  * @brief this method removes false cases in sha256 lookup tables.
- * tables which are enumerated in the unordered set sha256_plookup_tables
+ * tables which are enumerated in is_sha256_plookup_table
  * are used in read_from_1_to_2_table function which return C2[0], so C3[0]
  * isn't used anymore, but this situation isn't dangerous. So, we have to remove these variables.
  * @tparam FF
@@ -575,45 +654,25 @@ inline void Graph_<FF>::remove_unnecessary_aes_plookup_variables(std::unordered_
  */
 
 template <typename FF>
-inline void Graph_<FF>::remove_unnecessary_sha256_plookup_variables(std::unordered_set<uint32_t>& variables_in_one_gate,
+inline void Graph_<FF>::remove_unnecessary_sha256_plookup_variables(std::vector<bool>& variables_in_one_gate,
                                                                     UltraCircuitBuilder& ultra_circuit_builder,
                                                                     BasicTableId& table_id,
                                                                     size_t gate_index)
 {
-
-    auto find_position = [&](uint32_t real_variable_index) {
-        return variables_in_one_gate.contains(real_variable_index);
-    };
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
-    std::unordered_set<BasicTableId> sha256_plookup_tables{ BasicTableId::SHA256_WITNESS_SLICE_3,
-                                                            BasicTableId::SHA256_WITNESS_SLICE_7_ROTATE_4,
-                                                            BasicTableId::SHA256_WITNESS_SLICE_8_ROTATE_7,
-                                                            BasicTableId::SHA256_WITNESS_SLICE_14_ROTATE_1,
-                                                            BasicTableId::SHA256_BASE16,
-                                                            BasicTableId::SHA256_BASE16_ROTATE2,
-                                                            BasicTableId::SHA256_BASE16_ROTATE6,
-                                                            BasicTableId::SHA256_BASE16_ROTATE7,
-                                                            BasicTableId::SHA256_BASE16_ROTATE8,
-                                                            BasicTableId::SHA256_BASE28,
-                                                            BasicTableId::SHA256_BASE28_ROTATE3,
-                                                            BasicTableId::SHA256_BASE28_ROTATE6 };
-    if (sha256_plookup_tables.contains(table_id)) {
+    if (is_sha256_plookup_table(table_id)) {
         uint32_t real_right_idx = this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index]);
         uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
         if (variables_gate_counts[real_out_idx] != 1 || variables_gate_counts[real_right_idx] != 1) {
             // auto q_m = lookup_block.q_m()[gate_index];
             auto q_c = lookup_block.q_c()[gate_index];
-            bool find_out = find_position(real_out_idx);
-            // bool find_right = find_position(real_right_idx);
             if (q_c == 0) {
-                if (find_out) {
-                    variables_in_one_gate.erase(real_out_idx);
-                }
+                variables_in_one_gate[real_out_idx] = false;
             }
             if (table_id == SHA256_BASE16_ROTATE2 || table_id == SHA256_BASE28_ROTATE6) {
                 // we want to remove false cases for special tables even though their selectors != 0
                 // because they are used in read_from_1_to_2_table function, and they aren't dangerous
-                variables_in_one_gate.erase(real_out_idx);
+                variables_in_one_gate[real_out_idx] = false;
             }
         }
     }
@@ -631,52 +690,31 @@ inline void Graph_<FF>::remove_unnecessary_sha256_plookup_variables(std::unorder
 
 template <typename FF>
 inline void Graph_<FF>::process_current_plookup_gate(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                                     std::unordered_set<uint32_t>& variables_in_one_gate,
+                                                     std::vector<bool>& variables_in_one_gate,
                                                      size_t gate_index)
 {
-    auto find_position = [&](uint32_t real_variable_index) {
-        return variables_in_one_gate.contains(real_variable_index);
-    };
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
-    auto& lookup_tables = ultra_circuit_builder.lookup_tables;
     auto table_index = static_cast<size_t>(lookup_block.q_3()[gate_index]);
-    for (const auto& table : lookup_tables) {
-        if (table.table_index == table_index) {
-            std::set<bb::fr> column_1(table.column_1.begin(), table.column_1.end());
-            std::set<bb::fr> column_2(table.column_2.begin(), table.column_2.end());
-            std::set<bb::fr> column_3(table.column_3.begin(), table.column_3.end());
-            bb::plookup::BasicTableId table_id = table.id;
-            // false cases for AES
-            this->remove_unnecessary_aes_plookup_variables(
-                variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
-            // false cases for sha256
-            this->remove_unnecessary_sha256_plookup_variables(
-                variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
-            // if the amount of unique elements from columns of plookup tables = 1, it means that
-            // variable from this column aren't used and we can remove it.
-            if (column_1.size() == 1) {
-                uint32_t left_idx = lookup_block.w_l()[gate_index];
-                uint32_t real_left_idx = this->to_real(ultra_circuit_builder, left_idx);
-                bool find_left = find_position(real_left_idx);
-                if (find_left) {
-                    variables_in_one_gate.erase(real_left_idx);
-                }
-            }
-            if (column_2.size() == 1) {
-                uint32_t real_right_idx = this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index]);
-                bool find_right = find_position(real_right_idx);
-                if (find_right) {
-                    variables_in_one_gate.erase(real_right_idx);
-                }
-            }
-            if (column_3.size() == 1) {
-                uint32_t real_out_idx = this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index]);
-                bool find_out = find_position(real_out_idx);
-                if (find_out) {
-                    variables_in_one_gate.erase(real_out_idx);
-                }
-            }
-        }
+    if (table_index >= lookup_table_summaries.size() || !lookup_table_summaries[table_index].exists) {
+        return;
+    }
+    const auto& table = lookup_table_summaries[table_index];
+    bb::plookup::BasicTableId table_id = table.id;
+    // false cases for AES
+    this->remove_unnecessary_aes_plookup_variables(variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
+    // false cases for sha256
+    this->remove_unnecessary_sha256_plookup_variables(
+        variables_in_one_gate, ultra_circuit_builder, table_id, gate_index);
+    // if the amount of unique elements from columns of plookup tables = 1, it means that
+    // variable from this column aren't used and we can remove it.
+    if (table.column_is_constant[0]) {
+        variables_in_one_gate[this->to_real(ultra_circuit_builder, lookup_block.w_l()[gate_index])] = false;
+    }
+    if (table.column_is_constant[1]) {
+        variables_in_one_gate[this->to_real(ultra_circuit_builder, lookup_block.w_r()[gate_index])] = false;
+    }
+    if (table.column_is_constant[2]) {
+        variables_in_one_gate[this->to_real(ultra_circuit_builder, lookup_block.w_o()[gate_index])] = false;
     }
 }
 
@@ -689,8 +727,26 @@ inline void Graph_<FF>::process_current_plookup_gate(bb::UltraCircuitBuilder& ul
 
 template <typename FF>
 inline void Graph_<FF>::remove_unnecessary_plookup_variables(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                                             std::unordered_set<uint32_t>& variables_in_one_gate)
+                                                             std::vector<bool>& variables_in_one_gate)
 {
+    // summarize every table once, rather than once per gate reading from it
+    const auto column_is_constant = [](const std::vector<bb::fr>& column) {
+        return !column.empty() && std::all_of(column.begin(), column.end(), [&](const bb::fr& value) {
+            return value == column[0];
+        });
+    };
+    lookup_table_summaries.clear();
+    for (const auto& table : ultra_circuit_builder.lookup_tables) {
+        if (table.table_index >= lookup_table_summaries.size()) {
+            lookup_table_summaries.resize(table.table_index + 1);
+        }
+        lookup_table_summaries[table.table_index] = { true,
+                                                      table.id,
+                                                      { column_is_constant(table.column_1),
+                                                        column_is_constant(table.column_2),
+                                                        column_is_constant(table.column_3) } };
+    }
+
     auto& lookup_block = ultra_circuit_builder.blocks.lookup;
     if (lookup_block.size() > 0) {
         for (size_t i = 0; i < lookup_block.size(); i++) {
@@ -709,27 +765,35 @@ inline void Graph_<FF>::remove_unnecessary_plookup_variables(bb::UltraCircuitBui
 template <typename FF>
 std::unordered_set<uint32_t> Graph_<FF>::show_variables_in_one_gate(bb::UltraCircuitBuilder& ultra_circuit_builder)
 {
-    std::unordered_set<uint32_t> variables_in_one_gate;
-    for (const auto& pair : variables_gate_counts) {
-        bool is_not_constant_variable = this->check_is_not_constant_variable(ultra_circuit_builder, pair.first);
-        if (pair.second == 1 && pair.first != 0 && is_not_constant_variable) {
-            variables_in_one_gate.insert(pair.first);
+    const size_t num_variables = variables_gate_counts.size();
+    std::vector<bool> variables_in_one_gate(num_variables, false);
+    for (uint32_t variable_index = 1; variable_index < num_variables; variable_index++) {
+        bool is_not_constant_variable = this->check_is_not_constant_variable(ultra_circuit_builder, variable_index);
+        if (variables_gate_counts[variable_index] == 1 && is_not_constant_variable) {
+            variables_in_one_gate[variable_index] = true;
         }
     }
-    auto range_lists = ultra_circuit_builder.range_lists;
-    std::unordered_set<uint32_t> decompose_varialbes;
-    for (auto& pair : range_lists) {
-        for (auto& elem : pair.second.variable_indices) {
+    const auto& range_lists = ultra_circuit_builder.range_lists;
+    std::vector<bool> decompose_varialbes(num_variables, false);
+    for (const auto& pair : range_lists) {
+        for (const auto& elem : pair.second.variable_indices) {
             bool is_not_constant_variable = this->check_is_not_constant_variable(ultra_circuit_builder, elem);
             if (variables_gate_counts[ultra_circuit_builder.real_variable_index[elem]] == 1 &&
                 is_not_constant_variable) {
-                decompose_varialbes.insert(ultra_circuit_builder.real_variable_index[elem]);
+                decompose_varialbes[ultra_circuit_builder.real_variable_index[elem]] = true;
             }
         }
     }
     this->remove_unnecessary_decompose_variables(ultra_circuit_builder, variables_in_one_gate, decompose_varialbes);
     this->remove_unnecessary_plookup_variables(ultra_circuit_builder, variables_in_one_gate);
-    return variables_in_one_gate;
+
+    std::unordered_set<uint32_t> result;
+    for (uint32_t variable_index = 0; variable_index < num_variables; variable_index++) {
+        if (variables_in_one_gate[variable_index]) {
+            result.insert(variable_index);
+        }
+    }
+    return result;
 }
 
 /**
@@ -762,12 +826,12 @@ std::pair<std::vector<uint32_t>, size_t> get_connected_component_with_index(
 
 template <typename FF> void Graph_<FF>::print_graph()
 {
-    for (const auto& elem : variable_adjacency_lists) {
-        info("variable with index", elem.first);
-        if (variable_adjacency_lists[elem.first].empty()) {
+    for (uint32_t variable_index = 0; variable_index < variables_gate_counts.size(); variable_index++) {
+        info("variable with index", variable_index);
+        if (this->get_variable_degree(variable_index) == 0) {
             info("is isolated");
         } else {
-            for (const auto& it : elem.second) {
+            for (const auto& it : this->get_variable_adjacency_list(variable_index)) {
                 info(it);
             }
         }
@@ -799,8 +863,8 @@ template <typename FF> void Graph_<FF>::print_connected_components()
 
 template <typename FF> void Graph_<FF>::print_variables_gate_counts()
 {
-    for (const auto& it : variables_gate_counts) {
-        info("number of gates with variables ", it.first, " == ", it.second);
+    for (size_t variable_index = 0; variable_index < variables_gate_counts.size(); variable_index++) {
+        info("number of gates with variables ", variable_index, " == ", variables_gate_counts[variable_index]);
     }
 }
 
@@ -814,10 +878,11 @@ template <typename FF> void Graph_<FF>::print_variables_gate_counts()
 
 template <typename FF> void Graph_<FF>::print_variables_edge_counts()
 {
-    for (const auto& it : variables_degree) {
-        if (it.first != 0) {
-            info("variable index = ", it.first, "number of edges for this variable = ", it.second);
-        }
+    for (uint32_t variable_index = 1; variable_index < variables_gate_counts.size(); variable_index++) {
+        info("variable index = ",
+             variable_index,
+             "number of edges for this variable = ",
+             this->get_variable_degree(variable_index));
     }
 }
 
@@ -1,9 +1,8 @@
 #pragma once
 #include "barretenberg/stdlib_circuit_builders/standard_circuit_builder.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
-#include <list>
-#include <set>
-#include <unordered_map>
+#include <array>
+#include <span>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -15,6 +14,11 @@
  * connected components in the graph. if variable was in one connected component, it means that this variable wasn't
  * constrained properly. if number of connected components > 1, it means that there were missed some connections between
  * variables.
+ *
+ * variables are identified by their real variable index. the graph is stored in CSR form: the neighbours of a variable
+ * v are adjacency[adjacency_offsets[v], adjacency_offsets[v + 1]). the edges of the arithmetic, elliptic and lookup
+ * blocks are collected in parallel over chunks of gates, and the sets of variables used by the analysis are bitsets
+ * indexed by the variable, so that the analysis scales to circuits with tens of millions of gates.
  */
 template <typename FF> class Graph_ {
   public:
@@ -33,7 +37,7 @@ template <typename FF> class Graph_ {
     void process_gate_variables(bb::UltraCircuitBuilder& ultra_circuit_constructor,
                                 std::vector<uint32_t>& gate_variables);
 
-    std::unordered_map<uint32_t, size_t> get_variables_gate_counts() { return this->variables_gate_counts; };
+    const std::vector<size_t>& get_variables_gate_counts() { return this->variables_gate_counts; };
 
     std::vector<uint32_t> get_arithmetic_gate_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                   size_t index);
@@ -44,15 +48,16 @@ template <typename FF> class Graph_ {
     std::vector<uint32_t> get_sort_constraint_connected_component(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                                   size_t index);
 
-    void add_new_edge(const uint32_t& first_variable_index, const uint32_t& second_variable_index);
-    std::vector<uint32_t> get_variable_adjacency_list(const uint32_t& variable_index)
+    std::span<const uint32_t> get_variable_adjacency_list(const uint32_t& variable_index)
     {
-        return variable_adjacency_lists[variable_index];
+        return { adjacency.data() + adjacency_offsets[variable_index],
+                 adjacency.data() + adjacency_offsets[variable_index + 1] };
+    };
+    size_t get_variable_degree(const uint32_t& variable_index)
+    {
+        return adjacency_offsets[variable_index + 1] - adjacency_offsets[variable_index];
     };
 
-    void depth_first_search(const uint32_t& variable_index,
-                            std::unordered_set<uint32_t>& is_used,
-                            std::vector<uint32_t>& connected_component);
     std::vector<std::vector<uint32_t>> find_connected_components();
 
     std::vector<uint32_t> find_variables_with_degree_one();
@@ -69,7 +74,8 @@ template <typename FF> class Graph_ {
 
     void connect_all_variables_in_vector(bb::UltraCircuitBuilder& ultra_circuit_builder,
                                          const std::vector<uint32_t>& variables_vector,
-                                         bool is_sorted_variables);
+                                         bool is_sorted_variables,
+                                         std::vector<std::pair<uint32_t, uint32_t>>& edges);
     bool check_is_not_constant_variable(bb::UltraCircuitBuilder& ultra_circuit_builder, const uint32_t& variable_index);
 
     std::pair<std::vector<uint32_t>, size_t> get_connected_component_with_index(
@@ -79,23 +85,23 @@ template <typename FF> class Graph_ {
         bb::UltraCircuitBuilder& ultra_circuit_builder);
 
     size_t process_current_decompose_chain(bb::UltraCircuitBuilder& ultra_circuit_constructor,
-                                           std::unordered_set<uint32_t>& variables_in_one_gate,
+                                           std::vector<bool>& variables_in_one_gate,
                                            size_t index);
     void process_current_plookup_gate(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                      std::unordered_set<uint32_t>& variables_in_one_gate,
+                                      std::vector<bool>& variables_in_one_gate,
                                       size_t gate_index);
     void remove_unnecessary_decompose_variables(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                                std::unordered_set<uint32_t>& variables_in_on_gate,
-                                                const std::unordered_set<uint32_t>& decompose_variables);
+                                                std::vector<bool>& variables_in_on_gate,
+                                                const std::vector<bool>& decompose_variables);
     void remove_unnecessary_plookup_variables(bb::UltraCircuitBuilder& ultra_circuit_builder,
-                                              std::unordered_set<uint32_t>& variables_in_on_gate);
+                                              std::vector<bool>& variables_in_on_gate);
     std::unordered_set<uint32_t> show_variables_in_one_gate(bb::UltraCircuitBuilder& ultra_circuit_builder);
 
-    void remove_unnecessary_aes_plookup_variables(std::unordered_set<uint32_t>& variables_in_one_gate,
+    void remove_unnecessary_aes_plookup_variables(std::vector<bool>& variables_in_one_gate,
                                                   bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                   bb::plookup::BasicTableId& table_id,
                                                   size_t gate_index);
-    void remove_unnecessary_sha256_plookup_variables(std::unordered_set<uint32_t>& variables_in_one_gate,
+    void remove_unnecessary_sha256_plookup_variables(std::vector<bool>& variables_in_one_gate,
                                                      bb::UltraCircuitBuilder& ultra_circuit_builder,
                                                      bb::plookup::BasicTableId& table_id,
                                                      size_t gate_index);
@@ -107,13 +113,27 @@ template <typename FF> class Graph_ {
     ~Graph_() = default;
 
   private:
-    std::unordered_map<uint32_t, std::vector<uint32_t>>
-        variable_adjacency_lists; // we use this data structure to contain information about variables and their
-                                  // connections between each other
-    std::unordered_map<uint32_t, size_t>
-        variables_gate_counts; // we use this data structure to count, how many gates use every variable
-    std::unordered_map<uint32_t, size_t>
-        variables_degree; // we use this data structure to count, how many every variable have edges
+    // summary of a lookup table used to prune variables of lookup gates: its id and, for each column, whether the
+    // column holds a single value
+    struct LookupTableSummary {
+        bool exists = false;
+        bb::plookup::BasicTableId id{};
+        std::array<bool, 3> column_is_constant{};
+    };
+
+    template <typename GateVariablesFunction>
+    void process_gates(bb::UltraCircuitBuilder& ultra_circuit_builder,
+                       size_t num_gates,
+                       const GateVariablesFunction& get_gate_variables,
+                       std::vector<std::pair<uint32_t, uint32_t>>& edges);
+    void construct_adjacency(const std::vector<std::pair<uint32_t, uint32_t>>& edges);
+
+    std::vector<uint32_t> adjacency_offsets; // neighbours of the variable v are adjacency[adjacency_offsets[v],
+                                             // adjacency_offsets[v + 1]), so the degree of v is the size of this range
+    std::vector<uint32_t> adjacency;
+    std::vector<size_t> variables_gate_counts; // we use this data structure to count, how many gates use every variable
+    std::vector<bool> constant_variables;      // variable indices from the constant_variable_indices of the builder
+    std::vector<LookupTableSummary> lookup_table_summaries; // indexed by table_index
 };
 
 using Graph = Graph_<bb::fr>;
\ No newline at end of file
@@ -365,8 +365,8 @@ TEST(boomerang_ultra_circuit_constructor, test_variables_gates_counts_for_arithm
     Graph graph = Graph(circuit_constructor);
     auto variables_gate_counts = graph.get_variables_gate_counts();
     bool result = true;
-    for (const auto pair : variables_gate_counts) {
-        result = result && (pair.first > 0 ? (pair.second == 1) : (pair.second == 0));
+    for (size_t i = 0; i < variables_gate_counts.size(); i++) {
+        result = result && (i > 0 ? (variables_gate_counts[i] == 1) : (variables_gate_counts[i] == 0));
     }
     EXPECT_EQ(result, true);
 }
@@ -399,11 +399,12 @@ TEST(boomerang_ultra_circuit_constructor, test_variables_gates_counts_for_arithm
     Graph graph = Graph(circuit_constructor);
     bool result = true;
     auto variables_gate_counts = graph.get_variables_gate_counts();
-    for (const auto& pair : variables_gate_counts) {
-        if (pair.first > 0) {
-            result = result && (pair.first % 4 == 0 && pair.first != 4 ? (pair.second == 2) : (pair.second == 1));
+    for (size_t i = 0; i < variables_gate_counts.size(); i++) {
+        if (i > 0) {
+            result =
+                result && (i % 4 == 0 && i != 4 ? (variables_gate_counts[i] == 2) : (variables_gate_counts[i] == 1));
         } else {
-            result = result && (pair.second == 0);
+            result = result && (variables_gate_counts[i] == 0);
         }
     }
     EXPECT_EQ(result, true);
@@ -427,8 +428,8 @@ TEST(boomerang_ultra_circuit_constructor, test_variables_gates_counts_for_boolea
     Graph graph = Graph(circuit_constructor);
     auto variables_gate_counts = graph.get_variables_gate_counts();
     bool result = true;
-    for (const auto& part : variables_gate_counts) {
-        result = result && (part.first == 0 ? (part.second == 0) : (part.second == 1));
+    for (size_t i = 0; i < variables_gate_counts.size(); i++) {
+        result = result && (i == 0 ? (variables_gate_counts[i] == 0) : (variables_gate_counts[i] == 1));
     }
     EXPECT_EQ(result, true);
 }
@@ -658,4 +659,29 @@ TEST(boomerang_ultra_circuit_constructor, composed_range_constraint)
     Graph graph = Graph(circuit_constructor);
     auto connected_components = graph.find_connected_components();
     EXPECT_EQ(connected_components.size(), 1);
-}
\ No newline at end of file
+}
+/**
+ * @brief this test checks graph description of a circuit whose variables form one long chain a_0 - a_1 - ... - a_n.
+ * it must be one connected component, whose variables are sorted, and only the ends of the chain have degree 1
+ */
+
+TEST(boomerang_ultra_circuit_constructor, test_graph_for_long_chain)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+    const size_t chain_length = 1 << 16;
+    std::vector<uint32_t> chain{ circuit_constructor.add_variable(fr(1)) };
+    for (size_t i = 0; i < chain_length; ++i) {
+        uint32_t next_idx = circuit_constructor.add_variable(fr(i + 2));
+        circuit_constructor.create_add_gate(
+            { chain.back(), next_idx, circuit_constructor.zero_idx, fr(1), fr(-1), fr(0), fr(1) });
+        chain.emplace_back(next_idx);
+    }
+
+    Graph graph = Graph(circuit_constructor);
+    auto connected_components = graph.find_connected_components();
+    EXPECT_EQ(connected_components.size(), 1);
+    EXPECT_EQ(connected_components[0], chain);
+    EXPECT_EQ(graph.get_variable_degree(chain.front()), 1);
+    EXPECT_EQ(graph.get_variable_degree(chain[chain_length / 2]), 2);
+    EXPECT_EQ(graph.get_variable_degree(chain.back()), 1);
+}
@@ -233,6 +233,33 @@ TEST(UltraCircuitConstructor, NonTrivialTagPermutation)
     EXPECT_EQ(CircuitChecker::check(circuit_constructor), false);
 }
 
+#ifndef NDEBUG
+// Only run in an assert-enabled test suite.
+TEST(UltraCircuitConstructor, TagPermutationEdgeConditions)
+{
+    // Suppress warnings about fork(), we're OK with the edge cases.
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    auto remap_tag = []() {
+        UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+        circuit_constructor.create_tag(1, 2);
+        circuit_constructor.create_tag(1, 3);
+    };
+    ASSERT_DEATH(remap_tag(), ".*UNSET_TAU.*");
+    auto use_unmapped_tag = []() {
+        UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+        fr a = fr::random_element();
+        auto a_idx = circuit_constructor.add_variable(a);
+        auto zero_idx = circuit_constructor.zero_idx;
+        circuit_constructor.create_add_gate({ a_idx, zero_idx, zero_idx, fr::one(), fr::zero(), fr::zero(), -a });
+        // Tag 2 is mapped, but tag 1 never is
+        circuit_constructor.create_tag(2, 2);
+        circuit_constructor.assign_tag(a_idx, 1);
+        CircuitChecker::check(circuit_constructor);
+    };
+    ASSERT_DEATH(use_unmapped_tag(), ".*UNSET_TAU.*");
+}
+#endif
+
 TEST(UltraCircuitConstructor, NonTrivialTagPermutationAndCycles)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
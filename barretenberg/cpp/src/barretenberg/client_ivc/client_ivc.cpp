@@ -3,6 +3,19 @@
 
 namespace bb {
 
+/**
+ * @brief Wait for the folding of the last accumulated circuit to complete, if it is running in the background
+ * @details In pipelined mode the fold output and the verification queue are written by the background fold, so anything
+ * reading them (kernel completion logic, proof construction, external inspection of the queue) must call this first.
+ * Rethrows any exception raised by the fold.
+ */
+void ClientIVC::finish_pending_fold()
+{
+    if (pending_fold.valid()) {
+        pending_fold.get();
+    }
+}
+
 /**
  * @brief Instantiate a stdlib verification queue for use in the kernel completion logic
  * @details Construct a stdlib proof/verification_key for each entry in the native verification queue. By default, both
@@ -16,6 +29,8 @@ namespace bb {
 void ClientIVC::instantiate_stdlib_verification_queue(
     ClientCircuit& circuit, const std::vector<std::shared_ptr<RecursiveVerificationKey>>& input_keys)
 {
+    finish_pending_fold();
+
     bool vkeys_provided = !input_keys.empty();
     if (vkeys_provided && verification_queue.size() != input_keys.size()) {
         info("Warning: Incorrect number of verification keys provided in stdlib verification queue instantiation.");
@@ -127,6 +142,8 @@ void ClientIVC::process_recursive_merge_verification_queue(ClientCircuit& circui
  */
 void ClientIVC::complete_kernel_circuit_logic(ClientCircuit& circuit)
 {
+    finish_pending_fold();
+
     circuit.databus_propagation_data.is_kernel = true;
 
     // Instantiate stdlib verifier inputs from their native counterparts
@@ -153,6 +170,10 @@ void ClientIVC::complete_kernel_circuit_logic(ClientCircuit& circuit)
  * the folding accumulator. Otherwise, execute the PG prover to fold the proving key into the accumulator and produce a
  * folding proof. Also execute the merge protocol to produce a merge proof.
  *
+ * In pipelined mode (pipeline_memory_budget > 0) the folding runs in the background and this method returns as soon as
+ * it has been started. The proving key of the next circuit is then constructed while the fold is in flight, and the
+ * fold is waited on only once its output is needed: before the next fold, or by the kernel completion logic.
+ *
  * @param circuit
  * @param precomputed_vk
  */
@@ -170,14 +191,27 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
     // verifier.
     circuit.add_pairing_point_accumulator(stdlib::recursion::init_default_agg_obj_indices<ClientCircuit>(circuit));
 
+    // Holding the new proving key alongside an in-flight fold costs about one more key's worth of memory
+    if (proving_key_memory > pipeline_memory_budget) {
+        finish_pending_fold();
+    }
+
     // Construct the proving key for circuit
     std::shared_ptr<DeciderProvingKey> proving_key;
     if (!initialized) {
         proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_settings);
         trace_usage_tracker = ExecutionTraceUsageTracker(trace_settings);
+        commitment_key = proving_key->proving_key.commitment_key;
+        if (pipeline_memory_budget > 0) {
+            keygen_commitment_key = std::make_shared<CommitmentKey>(proving_key->proving_key.circuit_size);
+        }
     } else {
         proving_key = std::make_shared<DeciderProvingKey>(
-            circuit, trace_settings, fold_output.accumulator->proving_key.commitment_key);
+            circuit, trace_settings, pipeline_memory_budget > 0 ? keygen_commitment_key : commitment_key);
+    }
+    proving_key_memory = 0;
+    for (auto& poly : proving_key->proving_key.polynomials.get_unshifted()) {
+        proving_key_memory += poly.size() * sizeof(FF);
     }
 
     vinfo("getting honk vk... precomputed?: ", precomputed_vk);
@@ -209,13 +243,24 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
 
         initialized = true;
     } else { // Otherwise, fold the new key into the accumulator
-        FoldingProver folding_prover({ fold_output.accumulator, proving_key }, trace_usage_tracker);
-        vinfo("constructed folding prover");
-        fold_output = folding_prover.prove();
-        vinfo("constructed folding proof");
-
-        // Add fold proof and corresponding verification key to the verification queue
-        verification_queue.push_back(bb::ClientIVC::VerifierInputs{ fold_output.proof, honk_vk, QUEUE_TYPE::PG });
+        finish_pending_fold(); // the accumulator must be complete before it is folded again
+        // From here on the key is only committed to by the fold
+        proving_key->proving_key.commitment_key = commitment_key;
+        auto fold = [this, folding_prover = std::make_shared<FoldingProver>(
+                               std::vector{ fold_output.accumulator, proving_key }, trace_usage_tracker),
+                     vk = honk_vk]() {
+            vinfo("constructed folding prover");
+            fold_output = folding_prover->prove();
+            vinfo("constructed folding proof");
+
+            // Add fold proof and corresponding verification key to the verification queue
+            verification_queue.push_back(bb::ClientIVC::VerifierInputs{ fold_output.proof, vk, QUEUE_TYPE::PG });
+        };
+        if (pipeline_memory_budget > 0) {
+            pending_fold = std::async(std::launch::async, std::move(fold));
+        } else {
+            fold();
+        }
     }
 }
 
@@ -228,6 +273,7 @@ void ClientIVC::accumulate(ClientCircuit& circuit, const std::shared_ptr<Verific
  */
 HonkProof ClientIVC::construct_and_prove_hiding_circuit()
 {
+    finish_pending_fold();
     trace_usage_tracker.print(); // print minimum structured sizes for each block
     ASSERT(verification_queue.size() == 1);
     ASSERT(merge_verification_queue.size() == 1); // ensure only a single merge proof remains in the queue
@@ -380,13 +426,16 @@ std::vector<std::shared_ptr<ClientIVC::VerificationKey>> ClientIVC::precompute_f
         accumulate(circuit);
         vkeys.emplace_back(honk_vk);
     }
+    finish_pending_fold();
 
     // Reset the scheme so it can be reused for actual accumulation, maintaining the trace structure setting as is
     TraceSettings settings = trace_settings;
     bool auto_verify = auto_verify_mode;
+    size_t memory_budget = pipeline_memory_budget;
     *this = ClientIVC();
     this->trace_settings = settings;
     this->auto_verify_mode = auto_verify;
+    this->pipeline_memory_budget = memory_budget;
 
     return vkeys;
 }
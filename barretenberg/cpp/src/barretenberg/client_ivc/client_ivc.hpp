@@ -11,6 +11,7 @@
 #include "barretenberg/ultra_honk/decider_prover.hpp"
 #include "barretenberg/ultra_honk/decider_verifier.hpp"
 #include <algorithm>
+#include <future>
 
 namespace bb {
 
@@ -44,6 +45,7 @@ class ClientIVC {
     using TranslatorVerificationKey = bb::TranslatorFlavor::VerificationKey;
     using MegaProver = UltraProver_<Flavor>;
     using MegaVerifier = UltraVerifier_<Flavor>;
+    using CommitmentKey = Flavor::CommitmentKey;
 
     using RecursiveFlavor = MegaRecursiveFlavor_<bb::MegaCircuitBuilder>;
     using RecursiveDeciderVerificationKeys =
@@ -122,8 +124,16 @@ class ClientIVC {
     // Setting auto_verify_mode = true will cause kernel completion logic to be added to kernels automatically
     bool auto_verify_mode = false;
 
+    // Setting pipeline_memory_budget > 0 enables pipelined accumulation: the folding of each circuit runs in the
+    // background, overlapping with the construction of the next circuit and its proving key. The budget bounds (in
+    // bytes) the size of a proving key that may be constructed while a fold is in flight; larger keys wait for the fold.
+    size_t pipeline_memory_budget = 0;
+
     bool initialized = false; // Is the IVC accumulator initialized
 
+    // Wait for a fold running in the background (if any); its outputs are in fold_output and the verification queue
+    void finish_pending_fold();
+
     void instantiate_stdlib_verification_queue(
         ClientCircuit& circuit, const std::vector<std::shared_ptr<RecursiveVerificationKey>>& input_keys = {});
 
@@ -167,5 +177,22 @@ class ClientIVC {
 
     std::vector<std::shared_ptr<VerificationKey>> precompute_folding_verification_keys(
         std::vector<ClientCircuit> circuits);
+
+  private:
+    // Commitment key shared by all proving keys, taken from the first one so that constructing the next key does not
+    // touch the accumulator while it is being folded
+    std::shared_ptr<CommitmentKey> commitment_key;
+
+    // In pipelined mode, the commitment key used on the calling thread to construct the proving and verification keys
+    // of the next circuit while a fold is in flight: a commitment key holds the pippenger runtime state, so the folds and
+    // the key construction must each use their own
+    std::shared_ptr<CommitmentKey> keygen_commitment_key;
+
+    // Memory of the polynomials of the last proving key, used as an estimate for the next one in pipelined mode
+    size_t proving_key_memory = 0;
+
+    // Folding of the last accumulated circuit when running in the background. Declared last so that it is joined before
+    // the state it writes to is destroyed.
+    std::future<void> pending_fold;
 };
 } // namespace bb
\ No newline at end of file
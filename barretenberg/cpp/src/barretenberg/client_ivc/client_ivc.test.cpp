@@ -6,6 +6,7 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
 #include <gtest/gtest.h>
+#include <limits>
 
 using namespace bb;
 
@@ -151,6 +152,64 @@ TEST_F(ClientIVCTests, BasicFour)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief IVC for four mock circuits in pipelined mode, where each fold runs in the background while the next circuit and
+ * its proving key are constructed
+ *
+ */
+TEST_F(ClientIVCTests, BasicFourPipelined)
+{
+    ClientIVC ivc;
+    ivc.pipeline_memory_budget = std::numeric_limits<size_t>::max();
+
+    MockCircuitProducer circuit_producer;
+    for (size_t idx = 0; idx < 4; ++idx) {
+        Builder circuit = circuit_producer.create_next_circuit(ivc);
+        ivc.accumulate(circuit);
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief In pipelined mode, proving keys larger than the memory budget wait for the fold in flight before being
+ * constructed
+ *
+ */
+TEST_F(ClientIVCTests, PipelinedWithinMemoryBudget)
+{
+    ClientIVC ivc;
+    ivc.pipeline_memory_budget = 1;
+
+    MockCircuitProducer circuit_producer;
+    for (size_t idx = 0; idx < 4; ++idx) {
+        Builder circuit = circuit_producer.create_next_circuit(ivc);
+        ivc.accumulate(circuit);
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
+/**
+ * @brief In pipelined mode without precomputed verification keys, each verification key is computed while the previous
+ * fold is in flight; the two must not commit through the same commitment key (run under TSan to check)
+ *
+ */
+TEST_F(ClientIVCTests, PipelinedComputesVerificationKeysAlongsideFolds)
+{
+    ClientIVC ivc;
+    ivc.trace_settings.structure = TraceStructure::SMALL_TEST;
+    ivc.pipeline_memory_budget = std::numeric_limits<size_t>::max();
+
+    MockCircuitProducer circuit_producer;
+    for (size_t idx = 0; idx < 6; ++idx) {
+        Builder circuit = circuit_producer.create_next_circuit(ivc, /*log2_num_gates=*/5);
+        ivc.accumulate(circuit, /*precomputed_vk=*/nullptr);
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
 /**
  * @brief Check that the IVC fails if an intermediate fold proof is invalid
  * @details When accumulating 4 circuits, there are 3 fold proofs to verify (the first two are recursively verfied and
@@ -28,6 +28,19 @@ template <typename FF> Polynomial<FF> sparse_random_poly(const size_t size, cons
     return polynomial;
 }
 
+// Generate a polynomial with random coefficients of the given bit width (e.g. a selector, a tag or a u16 column)
+template <typename FF> Polynomial<FF> small_value_random_poly(const size_t size, const size_t num_bits)
+{
+    auto& engine = numeric::get_debug_randomness();
+    auto polynomial = Polynomial<FF>(size);
+
+    for (size_t i = 0; i < size; i++) {
+        polynomial.at(i) = FF(engine.get_random_uint32() & ((1U << num_bits) - 1));
+    }
+
+    return polynomial;
+}
+
 template <typename FF> struct PolyData {
     Polynomial<FF> polynomial;
     std::vector<std::pair<size_t, size_t>> active_range_endpoints;
@@ -85,6 +98,8 @@ constexpr size_t MIN_LOG_NUM_POINTS = 16;
 constexpr size_t MAX_LOG_NUM_POINTS = 20;
 constexpr size_t MAX_NUM_POINTS = 1 << MAX_LOG_NUM_POINTS;
 constexpr size_t SPARSE_NUM_NONZERO = 100;
+constexpr size_t SMALL_VALUE_NUM_POINTS = 1 << 18;
+constexpr size_t SMALL_VALUE_NUM_COLUMNS = 16;
 
 // Commit to a zero polynomial
 template <typename Curve> void bench_commit_zero(::benchmark::State& state)
@@ -247,6 +262,52 @@ template <typename Curve> void bench_commit_mock_z_perm_preprocessed(::benchmark
     }
 }
 
+// Commit to a column of state.range(0)-bit values with pippenger, as a baseline for the small-value path
+template <typename Curve> void bench_commit_small_values_pippenger(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const auto polynomial = small_value_random_poly<Fr>(SMALL_VALUE_NUM_POINTS, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
+// Commit to a column of state.range(0)-bit values; commit_sparse detects them and skips the MSM
+template <typename Curve> void bench_commit_small_values(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const auto polynomial = small_value_random_poly<Fr>(SMALL_VALUE_NUM_POINTS, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        key->commit_sparse(polynomial);
+    }
+}
+
+// Commit to many small-value columns at once (as the AVM prover does for its witness) with batch_commit_sparse
+template <typename Curve> void bench_batch_commit_small_values(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    std::vector<Polynomial<Fr>> polynomials;
+    std::vector<Polynomial<Fr>*> polynomial_ptrs;
+    for (size_t i = 0; i < SMALL_VALUE_NUM_COLUMNS; ++i) {
+        polynomials.emplace_back(
+            small_value_random_poly<Fr>(SMALL_VALUE_NUM_POINTS, static_cast<size_t>(state.range(0))));
+    }
+    for (auto& polynomial : polynomials) {
+        polynomial_ptrs.emplace_back(&polynomial);
+    }
+    for (auto _ : state) {
+        key->batch_commit_sparse({ polynomial_ptrs.data(), polynomial_ptrs.size() });
+    }
+    const auto num_columns = static_cast<double>(SMALL_VALUE_NUM_COLUMNS * static_cast<size_t>(state.iterations()));
+    state.counters["columns"] = benchmark::Counter(num_columns, benchmark::Counter::kIsRate);
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -272,6 +333,9 @@ BENCHMARK(bench_commit_structured_random_poly<curve::BN254>)->Unit(benchmark::kM
 BENCHMARK(bench_commit_structured_random_poly_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm<curve::BN254>)->Unit(benchmark::kMillisecond);
 BENCHMARK(bench_commit_mock_z_perm_preprocessed<curve::BN254>)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_values_pippenger<curve::BN254>)->Arg(1)->Arg(8)->Arg(16)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_small_values<curve::BN254>)->Arg(1)->Arg(8)->Arg(16)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_batch_commit_small_values<curve::BN254>)->Arg(1)->Arg(8)->Arg(16)->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
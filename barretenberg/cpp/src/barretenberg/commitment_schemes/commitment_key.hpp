@@ -9,6 +9,7 @@
 
 #include "barretenberg/common/debug_log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/ecc/scalar_multiplication/sorted_msm.hpp"
@@ -20,8 +21,11 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 namespace bb {
@@ -51,6 +55,149 @@ template <class Curve> class CommitmentKey {
         return numeric::round_up_power_2(num_points) + EXTRA_SRS_POINTS_FOR_ECCVM_IPA;
     }
 
+    /**
+     * @brief Copy the {point, endo point} pairs of the active ranges into contiguous memory
+     */
+    std::vector<G1> get_structured_points(const std::vector<std::pair<size_t, size_t>>& active_ranges,
+                                          const size_t total_num_scalars)
+    {
+        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
+        // endomorphism point (\beta*x, -y) at odd indices).
+        std::span<G1> point_table = srs->get_monomial_points();
+
+        std::vector<G1> points;
+        points.reserve(total_num_scalars * 2);
+        for (const auto& range : active_ranges) {
+            auto start = &point_table[2 * range.first];
+            auto end = &point_table[2 * range.second];
+            points.insert(points.end(), start, end);
+        }
+        return points;
+    }
+
+    Commitment commit_structured_with_points(PolynomialSpan<const Fr> polynomial,
+                                             const std::vector<std::pair<size_t, size_t>>& active_ranges,
+                                             std::span<const G1> points,
+                                             const size_t total_num_scalars)
+    {
+        std::vector<Fr> scalars;
+        scalars.reserve(total_num_scalars);
+        for (const auto& range : active_ranges) {
+            auto start = &polynomial[range.first];
+            auto end = &polynomial[range.second];
+            scalars.insert(scalars.end(), start, end);
+        }
+
+        // Call pippenger
+        return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
+    }
+
+    static size_t get_num_active_scalars(const std::vector<std::pair<size_t, size_t>>& active_ranges)
+    {
+        size_t total_num_scalars = 0;
+        for (const auto& range : active_ranges) {
+            total_num_scalars += range.second - range.first;
+        }
+        return total_num_scalars;
+    }
+
+    // Percentage of nonzero coefficients beyond which structured commitments resort to the conventional commit method
+    static constexpr size_t NONZERO_THRESHOLD = 75;
+
+    // Polynomials whose coefficients are all below 2^SMALL_VALUE_MAX_BITS are committed to via commit_small_values(),
+    // provided there are at least SMALL_VALUE_MIN_POINTS_PER_VALUE coefficients per possible value. Otherwise combining
+    // the per-value buckets costs more than the MSM it replaces.
+    static constexpr size_t SMALL_VALUE_MAX_BITS = 16;
+    static constexpr size_t SMALL_VALUE_MIN_POINTS_PER_VALUE = 4;
+
+    std::optional<uint64_t> get_small_value_path_bound(PolynomialSpan<const Fr> polynomial)
+    {
+        const auto max_value = get_small_value_bound(polynomial);
+        if (max_value && (*max_value + 1) * SMALL_VALUE_MIN_POINTS_PER_VALUE <= polynomial.size()) {
+            return max_value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Compute k⋅P for a small multiplier k by double-and-add
+     */
+    static typename Curve::Element mul_by_small_value(const typename Curve::Element& point, const uint64_t multiplier)
+    {
+        using Element = typename Curve::Element;
+        if (multiplier == 1) {
+            return point;
+        }
+        Element result = Element::infinity();
+        for (size_t bit = numeric::get_msb(multiplier) + 1; bit-- > 0;) {
+            result.self_dbl();
+            if (((multiplier >> bit) & 1) != 0) {
+                result += point;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Commit to a sparse polynomial with the conventional (pippenger) MSM on its nonzero {point, scalar} pairs
+     */
+    Commitment commit_sparse_with_pippenger(PolynomialSpan<const Fr> polynomial)
+    {
+        const size_t poly_size = polynomial.size();
+        ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+
+        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
+        // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
+        // with our polynomial span.
+        std::span<G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
+
+        // Define structures needed to multithread the extraction of non-zero inputs
+        const size_t num_threads = calculate_num_threads(poly_size);
+        const size_t block_size = (poly_size + num_threads - 1) / num_threads; // round up
+        std::vector<std::vector<Fr>> thread_scalars(num_threads);
+        std::vector<std::vector<G1>> thread_points(num_threads);
+
+        // Loop over all polynomial coefficients and keep {point, scalar} pairs for which scalar != 0
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+
+            for (size_t idx = start; idx < end; ++idx) {
+
+                const Fr& scalar = polynomial.span[idx];
+
+                if (!scalar.is_zero()) {
+                    thread_scalars[thread_idx].emplace_back(scalar);
+                    // Save both the raw srs point and the precomputed endomorphism point from the point table
+                    ASSERT(idx * 2 + 1 < point_table.size());
+                    const G1& point = point_table[idx * 2];
+                    const G1& endo_point = point_table[idx * 2 + 1];
+                    thread_points[thread_idx].emplace_back(point);
+                    thread_points[thread_idx].emplace_back(endo_point);
+                }
+            }
+        });
+
+        // Compute total number of non-trivial input pairs
+        size_t num_nonzero_scalars = 0;
+        for (auto& scalars : thread_scalars) {
+            num_nonzero_scalars += scalars.size();
+        }
+
+        // Reconstruct the full input to the pippenger from the individual threads
+        std::vector<Fr> scalars;
+        std::vector<G1> points;
+        scalars.reserve(num_nonzero_scalars);
+        points.reserve(2 * num_nonzero_scalars); //  2x accounts for endomorphism points
+        for (size_t idx = 0; idx < num_threads; ++idx) {
+            scalars.insert(scalars.end(), thread_scalars[idx].begin(), thread_scalars[idx].end());
+            points.insert(points.end(), thread_points[idx].begin(), thread_points[idx].end());
+        }
+
+        // Call the version of pippenger which assumes all points are distinct
+        return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
+    }
+
   public:
     scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<srs::factories::CrsFactory<Curve>> crs_factory;
@@ -124,7 +271,9 @@ template <class Curve> class CommitmentKey {
     /**
      * @brief Efficiently commit to a sparse polynomial
      * @details Iterate through the {point, scalar} pairs that define the inputs to the commitment MSM, maintain (copy)
-     * only those for which the scalar is nonzero, then perform the MSM on the reduced inputs.
+     * only those for which the scalar is nonzero, then perform the MSM on the reduced inputs. If every coefficient is
+     * small (selectors, tags, lookup counts, ...) relative to the size of the polynomial, the MSM is replaced by
+     * commit_small_values().
      * @warning Method makes a copy of all {point, scalar} pairs that comprise the reduced input. Will not be efficient
      * in terms of memory or computation for polynomials beyond a certain sparseness threshold.
      *
@@ -134,59 +283,172 @@ template <class Curve> class CommitmentKey {
     Commitment commit_sparse(PolynomialSpan<const Fr> polynomial)
     {
         PROFILE_THIS();
+        if (const auto max_value = get_small_value_path_bound(polynomial)) {
+            return commit_small_values(polynomial, *max_value);
+        }
+        return commit_sparse_with_pippenger(polynomial);
+    }
+
+    /**
+     * @brief Batched version of commit_sparse() for many independent columns, e.g. the AVM witness
+     * @details Columns are committed to one at a time, each commitment being parallel internally. Committing to the
+     * small-value columns concurrently instead would hold one set of bucket offsets and point copies per column in
+     * flight, so peak memory would grow with the number of threads.
+     *
+     * @param polynomials
+     * @return std::vector<Commitment> one commitment per polynomial, in order
+     */
+    std::vector<Commitment> batch_commit_sparse(RefSpan<Polynomial<Fr>> polynomials)
+    {
+        PROFILE_THIS();
+        std::vector<std::optional<uint64_t>> max_values(polynomials.size());
+        std::vector<size_t> small_indices;
+        std::vector<size_t> wide_indices;
+        for (size_t idx = 0; idx < polynomials.size(); ++idx) {
+            max_values[idx] = get_small_value_path_bound(polynomials[idx]);
+            (max_values[idx] ? small_indices : wide_indices).emplace_back(idx);
+        }
+
+        std::vector<Commitment> commitments(polynomials.size());
+        for (const size_t idx : small_indices) {
+            commitments[idx] = commit_small_values(polynomials[idx], *max_values[idx]);
+        }
+        for (const size_t idx : wide_indices) {
+            commitments[idx] = commit_sparse_with_pippenger(polynomials[idx]);
+        }
+        return commitments;
+    }
+
+    /**
+     * @brief Return the largest coefficient of the polynomial if all of them are below 2^SMALL_VALUE_MAX_BITS
+     * @details Every thread stops scanning as soon as a wide coefficient has been found by any of them, so the check is
+     * cheap for polynomials with random-looking coefficients.
+     *
+     * @param polynomial
+     * @return std::optional<uint64_t> the largest coefficient, or std::nullopt if some coefficient is too wide
+     */
+    static std::optional<uint64_t> get_small_value_bound(PolynomialSpan<const Fr> polynomial)
+    {
         const size_t poly_size = polynomial.size();
+        const size_t num_threads = calculate_num_threads(poly_size);
+        const size_t block_size = (poly_size + num_threads - 1) / num_threads; // round up
+        std::vector<uint64_t> thread_max_values(num_threads, 0);
+        std::atomic<bool> all_small = true;
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+            uint64_t max_value = 0;
+            for (size_t idx = start; idx < end && all_small.load(std::memory_order_relaxed); ++idx) {
+                const Fr& scalar = polynomial.span[idx];
+                if (scalar.is_zero()) {
+                    continue;
+                }
+                const Fr value = scalar.from_montgomery_form();
+                if ((value.data[1] | value.data[2] | value.data[3]) != 0 ||
+                    value.data[0] >= (1UL << SMALL_VALUE_MAX_BITS)) {
+                    all_small.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                max_value = std::max(max_value, value.data[0]);
+            }
+            thread_max_values[thread_idx] = max_value;
+        });
+
+        if (!all_small) {
+            return std::nullopt;
+        }
+        return *std::max_element(thread_max_values.begin(), thread_max_values.end());
+    }
+
+    /**
+     * @brief Commit to a polynomial whose coefficients are all at most max_value < 2^SMALL_VALUE_MAX_BITS
+     * @details The SRS points are bucketed by the value of their coefficient (a counting sort), each bucket Bᵥ is
+     * reduced to a single point with batched affine additions, and the buckets are then combined as ∑ᵥ v⋅Bᵥ by walking
+     * the distinct values v₁ < ... < vₖ downwards and keeping a running sum: the running sum Bᵥₖ + ... + Bᵥⱼ is added
+     * (vⱼ - vⱼ₋₁) times. This costs one affine addition per nonzero coefficient plus a few group operations per
+     * distinct value, instead of the ~254 bits worth of bucket additions done by pippenger. For a boolean polynomial
+     * there is a single bucket and the commitment is the plain subset sum of its points.
+     * @note Does not touch the pippenger runtime state, so distinct polynomials may be committed to concurrently.
+     *
+     * @param polynomial
+     * @param max_value an upper bound for the coefficients, e.g. as returned by get_small_value_bound()
+     * @return Commitment
+     */
+    Commitment commit_small_values(PolynomialSpan<const Fr> polynomial, const uint64_t max_value)
+    {
+        PROFILE_THIS();
+        using Element = typename Curve::Element;
+        static_assert(SMALL_VALUE_MAX_BITS <= 16, "Small values are stored as uint16_t");
         ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+        ASSERT(max_value < (1UL << SMALL_VALUE_MAX_BITS));
 
-        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
-        // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
-        // with our polynomial span.
+        // Extract the precomputed point table; only the raw srs points (at even indices) are needed here
         std::span<G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
 
-        // Define structures needed to multithread the extraction of non-zero inputs
+        const size_t poly_size = polynomial.size();
+        const size_t num_values = max_value + 1;
         const size_t num_threads = calculate_num_threads(poly_size);
         const size_t block_size = (poly_size + num_threads - 1) / num_threads; // round up
-        std::vector<std::vector<Fr>> thread_scalars(num_threads);
-        std::vector<std::vector<G1>> thread_points(num_threads);
 
-        // Loop over all polynomial coefficients and keep {point, scalar} pairs for which scalar != 0
+        // Convert the coefficients once and count the occurrences of each value within each thread's block. Counts are
+        // stored value-major so that a prefix sum yields, for each (value, thread), where its points are written.
+        std::vector<uint16_t> values(poly_size);
+        std::vector<size_t> offsets(num_values * num_threads, 0);
         parallel_for(num_threads, [&](size_t thread_idx) {
             const size_t start = thread_idx * block_size;
             const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
-
             for (size_t idx = start; idx < end; ++idx) {
+                const auto value = static_cast<uint16_t>(polynomial.span[idx].from_montgomery_form().data[0]);
+                values[idx] = value;
+                offsets[value * num_threads + thread_idx]++;
+            }
+        });
 
-                const Fr& scalar = polynomial.span[idx];
+        // Value 0 contributes nothing; for the others, record the bucket sizes and turn the counts into offsets
+        std::vector<size_t> sequence_counts;
+        std::vector<uint64_t> bucket_values;
+        size_t num_points = 0;
+        for (size_t value = 1; value < num_values; ++value) {
+            const size_t bucket_start = num_points;
+            for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+                const size_t count = offsets[value * num_threads + thread_idx];
+                offsets[value * num_threads + thread_idx] = num_points;
+                num_points += count;
+            }
+            if (num_points > bucket_start) {
+                sequence_counts.emplace_back(num_points - bucket_start);
+                bucket_values.emplace_back(value);
+            }
+        }
+        if (num_points == 0) {
+            return Commitment::infinity();
+        }
 
-                if (!scalar.is_zero()) {
-                    thread_scalars[thread_idx].emplace_back(scalar);
-                    // Save both the raw srs point and the precomputed endomorphism point from the point table
-                    ASSERT(idx * 2 + 1 < point_table.size());
-                    const G1& point = point_table[idx * 2];
-                    const G1& endo_point = point_table[idx * 2 + 1];
-                    thread_points[thread_idx].emplace_back(point);
-                    thread_points[thread_idx].emplace_back(endo_point);
+        // Scatter the points into their buckets
+        std::vector<G1> points(num_points);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t start = thread_idx * block_size;
+            const size_t end = std::min(poly_size, (thread_idx + 1) * block_size);
+            for (size_t idx = start; idx < end; ++idx) {
+                const uint16_t value = values[idx];
+                if (value != 0) {
+                    ASSERT(idx * 2 < point_table.size());
+                    points[offsets[value * num_threads + thread_idx]++] = point_table[idx * 2];
                 }
             }
         });
 
-        // Compute total number of non-trivial input pairs
-        size_t num_nonzero_scalars = 0;
-        for (auto& scalars : thread_scalars) {
-            num_nonzero_scalars += scalars.size();
+        // Reduce each bucket to a single point, then compute ∑ᵥ v⋅Bᵥ from the top bucket down
+        auto bucket_sums = BatchedAffineAddition<Curve>::add_in_place(points, sequence_counts);
+        Element running_sum = Element::infinity();
+        Element result = Element::infinity();
+        for (size_t k = bucket_values.size(); k-- > 0;) {
+            running_sum += bucket_sums[k];
+            const uint64_t next_value = k > 0 ? bucket_values[k - 1] : 0;
+            result += mul_by_small_value(running_sum, bucket_values[k] - next_value);
         }
-
-        // Reconstruct the full input to the pippenger from the individual threads
-        std::vector<Fr> scalars;
-        std::vector<G1> points;
-        scalars.reserve(num_nonzero_scalars);
-        points.reserve(2 * num_nonzero_scalars); //  2x accounts for endomorphism points
-        for (size_t idx = 0; idx < num_threads; ++idx) {
-            scalars.insert(scalars.end(), thread_scalars[idx].begin(), thread_scalars[idx].end());
-            points.insert(points.end(), thread_points[idx].begin(), thread_points[idx].end());
-        }
-
-        // Call the version of pippenger which assumes all points are distinct
-        return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
+        return Commitment(result);
     }
 
     /**
@@ -209,13 +471,7 @@ template <class Curve> class CommitmentKey {
         BB_OP_COUNT_TIME();
         ASSERT(polynomial.end_index() <= srs->get_monomial_size());
 
-        // Percentage of nonzero coefficients beyond which we resort to the conventional commit method
-        constexpr size_t NONZERO_THRESHOLD = 75;
-
-        size_t total_num_scalars = 0;
-        for (const auto& range : active_ranges) {
-            total_num_scalars += range.second - range.first;
-        }
+        const size_t total_num_scalars = get_num_active_scalars(active_ranges);
 
         // Compute "active" percentage of polynomial; resort to standard commit if appropriate
         size_t percentage_nonzero = total_num_scalars * 100 / polynomial.size();
@@ -223,27 +479,42 @@ template <class Curve> class CommitmentKey {
             return commit(polynomial);
         }
 
-        // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
-        // endomorphism point (\beta*x, -y) at odd indices).
-        std::span<G1> point_table = srs->get_monomial_points();
+        std::vector<G1> points = get_structured_points(active_ranges, total_num_scalars);
+        return commit_structured_with_points(polynomial, active_ranges, points, total_num_scalars);
+    }
 
-        std::vector<Fr> scalars;
-        scalars.reserve(total_num_scalars);
-        for (const auto& range : active_ranges) {
-            auto start = &polynomial[range.first];
-            auto end = &polynomial[range.second];
-            scalars.insert(scalars.end(), start, end);
-        }
+    /**
+     * @brief Batched version of commit_structured() for polynomials sharing the same active ranges
+     * @details The {point, endo point} pairs of the active ranges are copied into contiguous memory once and shared by
+     * every polynomial; only the scalars are copied per polynomial. Polynomials too dense for the structured method are
+     * committed to with commit().
+     *
+     * @param polynomials
+     * @param active_ranges
+     * @return std::vector<Commitment> one commitment per polynomial, in order
+     */
+    std::vector<Commitment> batch_commit_structured(RefSpan<Polynomial<Fr>> polynomials,
+                                                    const std::vector<std::pair<size_t, size_t>>& active_ranges)
+    {
+        BB_OP_COUNT_TIME();
+        const size_t total_num_scalars = get_num_active_scalars(active_ranges);
+
+        std::vector<Commitment> commitments;
+        commitments.reserve(polynomials.size());
         std::vector<G1> points;
-        points.reserve(total_num_scalars * 2);
-        for (const auto& range : active_ranges) {
-            auto start = &point_table[2 * range.first];
-            auto end = &point_table[2 * range.second];
-            points.insert(points.end(), start, end);
+        for (Polynomial<Fr>& polynomial : polynomials) {
+            ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+            if (total_num_scalars * 100 / polynomial.size() > NONZERO_THRESHOLD) {
+                commitments.emplace_back(commit(polynomial));
+                continue;
+            }
+            if (points.empty()) {
+                points = get_structured_points(active_ranges, total_num_scalars);
+            }
+            commitments.emplace_back(
+                commit_structured_with_points(polynomial, active_ranges, points, total_num_scalars));
         }
-
-        // Call pippenger
-        return scalar_multiplication::pippenger_unsafe<Curve>({ 0, scalars }, points, pippenger_runtime_state);
+        return commitments;
     }
 
     /**
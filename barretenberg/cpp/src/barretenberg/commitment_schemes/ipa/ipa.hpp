@@ -11,6 +11,7 @@
 #include "barretenberg/stdlib/honk_verifier/ipa_accumulator.hpp"
 #include "barretenberg/stdlib/transcript/transcript.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <string>
@@ -427,6 +428,147 @@ template <typename Curve_> class IPA {
         // Check if C_right == C₀
         return (C_zero.normalize() == right_hand_side.normalize());
     }
+    /**
+     * @brief Natively verify a batch of IPA proofs with a single MSM over the SRS
+     *
+     * @param vk Verification_key containing the srs to be used for the MSM
+     * @param opening_claims Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$ of each proof
+     * @param transcripts Transcripts with elements from the prover, one per opening claim
+     *
+     * @return true/false depending on if all the proofs verify
+     *
+     * @details Each proof is processed as in \link IPA::reduce_verify_internal_native reduce_verify_internal_native
+     * \endlink, except that \f$G_s=\langle \vec{s},\vec{G}\rangle\f$ is not computed per proof. Instead the verifier
+     * takes the \f$G_0\f$ sent by the prover and checks two random linear combinations, with weights
+     * \f$\rho_j, \sigma_j\f$ that the prover cannot predict:
+     *
+     *1. \f$\sum_j \rho_j (C_{0,j} - a_{0,j}G_{0,j} - a_{0,j}b_{0,j}U_j) = 0\f$, i.e. step 11 for every proof
+     *2. \f$\sum_j \sigma_j G_{0,j} = \langle \sum_j \sigma_j\vec{s}_j,\vec{G}\rangle\f$, i.e. that every \f$G_{0,j}\f$ is
+     *the \f$G_s\f$ defined by its round challenges
+     *
+     * Both are checked as one equation whose left hand side is a small MSM over the \f$C_j, L_{i,j}, R_{i,j}, G_{0,j}\f$
+     * and the generator, and whose right hand side is a single MSM over the SRS, of the length of the longest proof. A
+     * batch containing an invalid proof passes with negligible probability.
+     */
+    static bool batch_reduce_verify_internal_native(const std::shared_ptr<VK>& vk,
+                                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                                    const std::vector<std::shared_ptr<NativeTranscript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        const size_t num_claims = opening_claims.size();
+        if (transcripts.size() != num_claims) {
+            throw_or_abort("IPA batch verification needs one transcript per opening claim");
+        }
+        if (num_claims == 0) {
+            return true;
+        }
+
+        std::span<const Commitment> srs_elements = vk->get_monomial_points();
+        // Points and scalars of the left hand side MSM
+        std::vector<Commitment> msm_elements;
+        std::vector<Fr> msm_scalars;
+        msm_elements.reserve(num_claims * (2 * CONST_ECCVM_LOG_N + 2) + 1);
+        msm_scalars.reserve(num_claims * (2 * CONST_ECCVM_LOG_N + 2) + 1);
+        // Accumulated coefficient of the generator, which absorbs the U_j terms
+        Fr generator_scalar = Fr::zero();
+        // σ_j and the challenges defining s_j, used to build the SRS MSM scalars once every proof has been read
+        std::vector<Fr> sigmas(num_claims);
+        std::vector<std::vector<Fr>> s_challenges(num_claims);
+        size_t max_poly_length = 0;
+
+        auto add_msm_term = [&](const Commitment& element, const Fr& scalar) {
+            if (!element.is_point_at_infinity() && !scalar.is_zero()) {
+                msm_elements.emplace_back(element);
+                msm_scalars.emplace_back(scalar);
+            }
+        };
+
+        for (size_t j = 0; j < num_claims; j++) {
+            const auto& opening_claim = opening_claims[j];
+            const auto& transcript = transcripts[j];
+            const Fr rho = Fr::random_element();
+            const Fr sigma = Fr::random_element();
+            sigmas[j] = sigma;
+
+            auto poly_length = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
+                "IPA:poly_degree_plus_1"));
+            const Fr generator_challenge = transcript->template get_challenge<Fr>("IPA:generator_challenge");
+            if (generator_challenge.is_zero()) {
+                throw_or_abort("The generator challenge can't be zero");
+            }
+            auto log_poly_length = static_cast<size_t>(numeric::get_msb(poly_length));
+            if (log_poly_length > CONST_ECCVM_LOG_N) {
+                throw_or_abort("IPA log_poly_length is too large");
+            }
+            if (poly_length * 2 > srs_elements.size()) {
+                throw_or_abort("potential bug: Not enough SRS points for IPA!");
+            }
+            max_poly_length = std::max(max_poly_length, static_cast<size_t>(poly_length));
+
+            // ρ_j C_0 = ρ_j (C + f(β)⋅U + ∑_{i ∈ [k]} u_i^{-1}L_i + ∑_{i ∈ [k]} u_iR_i)
+            add_msm_term(opening_claim.commitment, rho);
+            std::vector<Fr> round_challenges_inv(CONST_ECCVM_LOG_N);
+            for (size_t i = 0; i < CONST_ECCVM_LOG_N; i++) {
+                std::string index = std::to_string(CONST_ECCVM_LOG_N - i - 1);
+                auto element_L = transcript->template receive_from_prover<Commitment>("IPA:L_" + index);
+                auto element_R = transcript->template receive_from_prover<Commitment>("IPA:R_" + index);
+                const Fr round_challenge = transcript->template get_challenge<Fr>("IPA:round_challenge_" + index);
+                if (round_challenge.is_zero()) {
+                    throw_or_abort("Round challenges can't be zero");
+                }
+                round_challenges_inv[i] = round_challenge.invert();
+                if (i < log_poly_length) {
+                    add_msm_term(element_L, rho * round_challenges_inv[i]);
+                    add_msm_term(element_R, rho * round_challenge);
+                }
+            }
+
+            Fr b_zero = Fr::one();
+            for (size_t i = 0; i < log_poly_length; i++) {
+                b_zero *= Fr::one() + (round_challenges_inv[log_poly_length - 1 - i] *
+                                       opening_claim.opening_pair.challenge.pow(1 << i));
+            }
+
+            Commitment G_zero = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+            auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+
+            // -ρ_j a_0 G_0 + σ_j G_0, and ρ_j (f(β) - a_0 b_0) U with U = u⋅[1]
+            add_msm_term(G_zero, sigma - rho * a_zero);
+            generator_scalar += rho * generator_challenge * (opening_claim.opening_pair.evaluation - a_zero * b_zero);
+            round_challenges_inv.resize(log_poly_length);
+            s_challenges[j] = std::move(round_challenges_inv);
+        }
+        add_msm_term(Commitment::one(), generator_scalar);
+
+        // ∑_j σ_j s_j, the scalars of the SRS MSM
+        Polynomial<Fr> s_combined(max_poly_length);
+        for (size_t j = 0; j < num_claims; j++) {
+            Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(s_challenges[j].size(), s_challenges[j]));
+            const Fr& sigma = sigmas[j];
+            parallel_for_heuristic(
+                s_poly.size(),
+                [&](size_t i) { s_combined.at(i) += sigma * s_poly[i]; },
+                thread_heuristics::FF_MULTIPLICATION_COST + thread_heuristics::FF_ADDITION_COST);
+        }
+
+        // The left hand side may contain repeated points (e.g. identical proofs), so edge cases must be handled
+        GroupElement left_hand_side = GroupElement::infinity();
+        if (!msm_elements.empty()) {
+            std::vector<Commitment> msm_point_table(msm_elements.size() * 2);
+            bb::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                msm_elements.data(), msm_point_table.data(), msm_elements.size());
+            bb::scalar_multiplication::pippenger_runtime_state<Curve> msm_state(msm_elements.size());
+            left_hand_side = bb::scalar_multiplication::pippenger<Curve>(
+                { 0, msm_scalars }, msm_point_table, msm_state, /*handle_edge_cases=*/true);
+        }
+        // The SRS held by the key is already in pippenger point table form, so it is used in place. Its points are
+        // distinct and never the point at infinity, so edge cases can be skipped
+        GroupElement right_hand_side =
+            bb::scalar_multiplication::pippenger_unsafe<Curve>(s_combined, srs_elements, vk->pippenger_runtime_state);
+
+        return left_hand_side.normalize() == right_hand_side.normalize();
+    }
+
     /**
      * @brief  Recursively verify the correctness of an IPA proof. Unlike native verification, there is no
      * parallelisation in this function as our circuit construction does not currently support parallelisation.
@@ -571,6 +713,26 @@ template <typename Curve_> class IPA {
         return reduce_verify_internal_native(vk, opening_claim, transcript);
     }
 
+    /**
+     * @brief Natively verify a batch of IPA proofs, at the cost of roughly one single proof verification
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$ of each proof
+     * @param transcripts Transcripts with elements from the prover and generated challenges, one per claim
+     *
+     * @return true if all of the proofs verify
+     *
+     *@remark The verification procedure documentation is in \link IPA::batch_reduce_verify_internal_native
+     *batch_reduce_verify_internal_native \endlink
+     */
+    static bool batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                    const std::vector<OpeningClaim<Curve>>& opening_claims,
+                                    const std::vector<std::shared_ptr<NativeTranscript>>& transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        return batch_reduce_verify_internal_native(vk, opening_claims, transcripts);
+    }
+
     /**
      * @brief Recursively verify the correctness of a proof
      *
@@ -224,6 +224,70 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+TEST_F(IPATest, BatchVerify)
+{
+    using IPA = IPA<Curve>;
+    // Proofs of different lengths, including the same proof twice
+    std::vector<size_t> poly_lengths = { 64, 128, 128, 256 };
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<std::shared_ptr<NativeTranscript>> prover_transcripts;
+    for (size_t n : poly_lengths) {
+        auto poly = Polynomial::random(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, this->commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+        prover_transcripts.push_back(prover_transcript);
+    }
+    opening_claims.push_back(opening_claims[0]);
+    prover_transcripts.push_back(prover_transcripts[0]);
+
+    auto make_verifier_transcripts = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& prover_transcript : prover_transcripts) {
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>(prover_transcript->proof_data));
+        }
+        return verifier_transcripts;
+    };
+
+    EXPECT_TRUE(IPA::batch_reduce_verify(this->vk(), opening_claims, make_verifier_transcripts()));
+    EXPECT_TRUE(IPA::batch_reduce_verify(this->vk(), {}, {}));
+
+    // A single wrong evaluation makes the whole batch fail
+    auto bad_opening_claims = opening_claims;
+    bad_opening_claims[2].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), bad_opening_claims, make_verifier_transcripts()));
+}
+
+TEST_F(IPATest, BatchVerifyRejectsWrongGZero)
+{
+    using IPA = IPA<Curve>;
+    constexpr size_t n = 128;
+    auto poly = Polynomial::random(n);
+    auto [x, eval] = this->random_eval(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    const OpeningClaim<Curve> opening_claim{ opening_pair, this->commit(poly) };
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    IPA::compute_opening_proof(this->ck(), { poly, opening_pair }, prover_transcript);
+
+    // Replace G_0 by another point. G_0 is the last commitment in the transcript, before a_0. The batch verifier does
+    // not recompute G_0 per proof, so it has to detect this through the SRS MSM.
+    auto proof_data = prover_transcript->proof_data;
+    constexpr size_t commitment_size = field_conversion::calc_num_bn254_frs<Commitment>();
+    constexpr size_t fr_size = field_conversion::calc_num_bn254_frs<Fr>();
+    const size_t g_zero_offset = proof_data.size() - fr_size - commitment_size;
+    auto g_zero = field_conversion::convert_from_bn254_frs<Commitment>(
+        std::span<const bb::fr>(proof_data).subspan(g_zero_offset, commitment_size));
+    auto bad_g_zero = field_conversion::convert_to_bn254_frs(Commitment(g_zero + Commitment::one()));
+    std::copy(bad_g_zero.begin(), bad_g_zero.end(), proof_data.begin() + static_cast<std::ptrdiff_t>(g_zero_offset));
+
+    std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts = {
+        std::make_shared<NativeTranscript>(prover_transcript->proof_data), std::make_shared<NativeTranscript>(proof_data)
+    };
+    EXPECT_FALSE(IPA::batch_reduce_verify(this->vk(), { opening_claim, opening_claim }, verifier_transcripts));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
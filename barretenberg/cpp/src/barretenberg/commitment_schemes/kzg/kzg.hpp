@@ -108,15 +108,11 @@ template <typename Curve_> class KZG {
     static VerifierAccumulator reduce_verify_batch_opening_claim(BatchOpeningClaim<Curve> batch_opening_claim,
                                                                  const std::shared_ptr<Transcript>& transcript)
     {
-        auto quotient_commitment = transcript->template receive_from_prover<Commitment>("KZG:W");
-
         // The pairing check can be expressed as
         // e(C + [W]₁ ⋅ z, [1]₂) * e(−[W]₁, [X]₂) = 1, where C = ∑ commitmentsᵢ ⋅ scalarsᵢ.
+        batch_opening_claim = append_quotient_commitment(std::move(batch_opening_claim), transcript);
+        const Commitment quotient_commitment = batch_opening_claim.commitments.back();
         GroupElement P_0;
-        // Place the commitment to W to 'commitments'
-        batch_opening_claim.commitments.emplace_back(quotient_commitment);
-        // Update the scalars by adding the Shplonk evaluation challenge z
-        batch_opening_claim.scalars.emplace_back(batch_opening_claim.evaluation_point);
         // Compute C + [W]₁ ⋅ z
         if constexpr (Curve::is_stdlib_type) {
             P_0 = GroupElement::batch_mul(batch_opening_claim.commitments,
@@ -130,5 +126,24 @@ template <typename Curve_> class KZG {
 
         return { P_0, P_1 };
     }
+
+    /**
+     * @brief Receive the commitment \f$ [W]_1 \f$ to the KZG quotient and append it to a batch opening claim obtained
+     * from a Shplemini accumulator, with the Shplonk evaluation challenge \f$ z \f$ as its scalar
+     * @details The pairing points of the claim are then \f$ P_0 = \sum \text{commitments}_i \cdot \text{scalars}_i \f$
+     * and \f$ P_1 = -[W]_1 \f$, the last commitment. Leaving \f$ P_0 \f$ as an MSM lets a native verifier of many
+     * proofs fold the \f$ P_0 \f$ of all of them into a single MSM.
+     */
+    template <typename Transcript>
+    static BatchOpeningClaim<Curve> append_quotient_commitment(BatchOpeningClaim<Curve> batch_opening_claim,
+                                                               const std::shared_ptr<Transcript>& transcript)
+    {
+        auto quotient_commitment = transcript->template receive_from_prover<Commitment>("KZG:W");
+        // Place the commitment to W to 'commitments'
+        batch_opening_claim.commitments.emplace_back(quotient_commitment);
+        // Update the scalars by adding the Shplonk evaluation challenge z
+        batch_opening_claim.scalars.emplace_back(batch_opening_claim.evaluation_point);
+        return batch_opening_claim;
+    }
 };
 } // namespace bb
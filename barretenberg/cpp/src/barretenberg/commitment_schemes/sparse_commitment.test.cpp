@@ -1,5 +1,6 @@
 #include "barretenberg/commitment_schemes/commitment_key.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
@@ -296,6 +297,90 @@ TYPED_TEST(CommitmentKeyTest, CommitSparseMediumNonZeroStartIndex)
     EXPECT_EQ(sparse_commit_result, commit_result);
 }
 
+/**
+ * @brief Test that polynomials with small coefficients (committed to via commit_small_values) agree with the
+ * conventional commit method, including with a nonzero start index
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, CommitSparseSmallValues)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t offset = 1 << 8;
+    auto& engine = numeric::get_debug_randomness();
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+
+    for (const size_t num_bits : { 1UL, 4UL, 9UL }) {
+        // Roughly a third of the coefficients are zero
+        Polynomial poly(num_points - offset, num_points, offset);
+        for (size_t i = offset; i < num_points; ++i) {
+            if (engine.get_random_uint8() % 3 != 0) {
+                poly.at(i) = Fr(engine.get_random_uint32() & ((1U << num_bits) - 1));
+            }
+        }
+
+        ASSERT_TRUE(CK::get_small_value_bound(poly).has_value());
+        G1 commit_result = key->commit(poly);
+        G1 sparse_commit_result = key->commit_sparse(poly);
+        EXPECT_EQ(sparse_commit_result, commit_result);
+    }
+
+    // Wider values are only routed to commit_small_values for large enough polynomials, but it may be called directly
+    Polynomial u16_poly(num_points, num_points, 0);
+    for (size_t i = 0; i < num_points; ++i) {
+        u16_poly.at(i) = Fr(engine.get_random_uint16());
+    }
+    const auto max_value = CK::get_small_value_bound(u16_poly);
+    ASSERT_TRUE(max_value.has_value());
+    EXPECT_EQ(key->commit_small_values(u16_poly, *max_value), key->commit(u16_poly));
+
+    // The zero polynomial commits to the point at infinity
+    Polynomial zero(num_points, num_points, 0);
+    EXPECT_EQ(key->commit_sparse(zero), key->commit(zero));
+}
+
+/**
+ * @brief Test that batch_commit_sparse agrees with commit for a mix of small-value and wide polynomials
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, BatchCommitSparse)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    Polynomial selector(num_points, num_points, 0);
+    Polynomial bytes(num_points - 1, num_points, 1);
+    Polynomial wide(num_points, num_points, 0);
+    for (size_t i = 1; i < num_points; ++i) {
+        selector.at(i) = Fr(i % 5 == 0 ? 1 : 0);
+        bytes.at(i) = Fr(i % 256);
+        wide.at(i) = i % 7 == 0 ? Fr::random_element() : Fr(0);
+    }
+    // One out-of-range value sends the whole polynomial through the pippenger path
+    Polynomial almost_small = bytes.full();
+    almost_small.at(num_points - 1) = Fr(1UL << 16);
+
+    EXPECT_FALSE(CK::get_small_value_bound(wide).has_value());
+    EXPECT_FALSE(CK::get_small_value_bound(almost_small).has_value());
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    auto results = key->batch_commit_sparse(RefArray{ selector, wide, bytes, almost_small });
+
+    ASSERT_EQ(results.size(), 4);
+    EXPECT_EQ(results[0], key->commit(selector));
+    EXPECT_EQ(results[1], key->commit(wide));
+    EXPECT_EQ(results[2], key->commit(bytes));
+    EXPECT_EQ(results[3], key->commit(almost_small));
+}
+
 /**
  * @brief Test commit_structured on polynomial with blocks of non-zero values (like wires when using structured trace)
  *
@@ -355,4 +440,30 @@ TYPED_TEST(CommitmentKeyTest, CommitStructuredNonzeroComplement)
     EXPECT_EQ(result, expected_result);
 }
 
+
+/**
+ * @brief Test that batch_commit_structured agrees with commit_structured for several wire-like polynomials
+ *
+ */
+TYPED_TEST(CommitmentKeyTest, BatchCommitStructuredWires)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+
+    std::vector<uint32_t> fixed_sizes = { 1000, 4000, 180000, 90000, 9000, 137000, 72000, 4000, 2500, 11500 };
+    std::vector<uint32_t> actual_sizes = { 10, 16, 48873, 18209, 4132, 23556, 35443, 3, 2, 2 };
+
+    auto [w_l, active_range_endpoints] = TestFixture::create_structured_test_polynomial(fixed_sizes, actual_sizes);
+    auto w_r = TestFixture::create_structured_test_polynomial(fixed_sizes, actual_sizes).polynomial;
+    auto w_o = TestFixture::create_structured_test_polynomial(fixed_sizes, actual_sizes).polynomial;
+
+    auto key = TestFixture::template create_commitment_key<CK>(w_l.virtual_size());
+    auto results = key->batch_commit_structured(RefArray{ w_l, w_r, w_o }, active_range_endpoints);
+
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0], key->commit(w_l));
+    EXPECT_EQ(results[1], key->commit(w_r));
+    EXPECT_EQ(results[2], key->commit(w_o));
+}
+
 } // namespace bb
@@ -0,0 +1,270 @@
+#ifndef NO_MULTITHREADING
+#include "log.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * @brief A work-stealing scheduler with one deque per worker.
+ *
+ * @details Every parallel_for call creates a Job on the caller's stack. The job is isolated from every other job: it
+ * owns its own completion counter and only references the caller's function, so independent callers (e.g. two provers
+ * in the same process) never share iteration state. The job is seeded as a single range task. Whoever executes a range
+ * task splits it in half, pushes the upper half onto its own deque and continues on the lower half, until a single
+ * chunk of at most `grain` iterations remains, which it runs in one go. Owners pop from the back of their deque (LIFO,
+ * cache-warm), thieves steal from the front (the largest remaining ranges).
+ *
+ * The caller of parallel_for never sleeps while its job is outstanding: it executes tasks of its own job itself, popped
+ * from its deque or stolen from others. This is what makes nesting work. A parallel_for issued from inside a task on a
+ * worker thread pushes onto that worker's deque and the worker helps until the nested job completes, while idle workers
+ * steal from it. A waiting caller never picks up tasks of unrelated jobs, so it cannot end up waiting on (or holding a
+ * lock needed by) work it has no business running, and its stack only nests as deep as the parallel_for calls do.
+ * Threads that are not workers of the scheduler share one injection deque.
+ *
+ * If an iteration throws, the remaining iterations of the job are skipped and the first exception is rethrown to the
+ * caller of parallel_for once every task of the job has retired.
+ */
+class WorkStealingScheduler {
+  public:
+    WorkStealingScheduler(size_t num_workers);
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func);
+
+  private:
+    struct Job {
+        Job(const std::function<void(size_t)>& func, size_t grain, size_t num_iterations)
+            : func(func)
+            , grain(grain)
+            , remaining(num_iterations)
+        {}
+
+        const std::function<void(size_t)>& func;
+        const size_t grain;
+        std::atomic<size_t> remaining;
+        std::atomic<bool> failed = false;
+        std::mutex exception_mutex;
+        std::exception_ptr exception;
+    };
+
+    struct Task {
+        Job* job;
+        size_t begin;
+        size_t end;
+    };
+
+    // Each deque on its own cache line(s) to avoid false sharing between owners.
+    struct alignas(64) TaskDeque {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    // Ranges are split into about this many chunks per thread, enough to balance uneven iterations without paying a
+    // deque round trip per iteration.
+    static constexpr size_t CHUNKS_PER_THREAD = 8;
+    static constexpr size_t NOT_A_WORKER = std::numeric_limits<size_t>::max();
+    // Index of the deque owned by the current thread in the scheduler it works for.
+    static thread_local size_t worker_index;
+
+    std::vector<std::thread> workers;
+    // One deque per worker, plus the injection deque (last) shared by external threads.
+    std::vector<std::unique_ptr<TaskDeque>> deques;
+    std::atomic<size_t> num_queued_tasks = 0;
+    std::atomic<size_t> num_sleeping = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+
+    size_t injection_index() const { return deques.size() - 1; }
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+    void push(size_t deque_index, const Task& task);
+    std::optional<Task> pop(size_t deque_index, const Job* only_job = nullptr);
+    std::optional<Task> steal(size_t thief_index, const Job* only_job = nullptr);
+    std::optional<Task> find_task(size_t deque_index, const Job* only_job = nullptr);
+    void execute(Task task, size_t deque_index);
+};
+
+thread_local size_t WorkStealingScheduler::worker_index = WorkStealingScheduler::NOT_A_WORKER;
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+{
+    deques.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        deques.emplace_back(std::make_unique<TaskDeque>());
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingScheduler::worker_loop, this, i);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingScheduler::push(size_t deque_index, const Task& task)
+{
+    {
+        std::unique_lock<std::mutex> lock(deques[deque_index]->mutex);
+        deques[deque_index]->tasks.push_back(task);
+    }
+    // A worker bumps num_sleeping (under the sleep mutex) before checking num_queued_tasks, and we bump
+    // num_queued_tasks before checking num_sleeping, so either it sees our task or we see it sleeping. Taking the sleep
+    // mutex then orders the notify after its wait, so no wakeup is lost, and pushes only pay for it when a worker sleeps.
+    num_queued_tasks.fetch_add(1, std::memory_order_seq_cst);
+    if (num_sleeping.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+    { std::unique_lock<std::mutex> lock(sleep_mutex); }
+    sleep_condition.notify_one();
+}
+
+std::optional<WorkStealingScheduler::Task> WorkStealingScheduler::pop(size_t deque_index, const Job* only_job)
+{
+    std::unique_lock<std::mutex> lock(deques[deque_index]->mutex);
+    auto& tasks = deques[deque_index]->tasks;
+    if (tasks.empty() || (only_job != nullptr && tasks.back().job != only_job)) {
+        return std::nullopt;
+    }
+    Task task = tasks.back();
+    tasks.pop_back();
+    num_queued_tasks.fetch_sub(1, std::memory_order_relaxed);
+    return task;
+}
+
+std::optional<WorkStealingScheduler::Task> WorkStealingScheduler::steal(size_t thief_index, const Job* only_job)
+{
+    const size_t num_deques = deques.size();
+    for (size_t offset = 1; offset < num_deques; ++offset) {
+        auto& victim = *deques[(thief_index + offset) % num_deques];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty() ||
+            (only_job != nullptr && victim.tasks.front().job != only_job)) {
+            continue;
+        }
+        Task task = victim.tasks.front();
+        victim.tasks.pop_front();
+        num_queued_tasks.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+    return std::nullopt;
+}
+
+std::optional<WorkStealingScheduler::Task> WorkStealingScheduler::find_task(size_t deque_index, const Job* only_job)
+{
+    if (auto task = pop(deque_index, only_job)) {
+        return task;
+    }
+    return steal(deque_index, only_job);
+}
+
+void WorkStealingScheduler::execute(Task task, size_t deque_index)
+{
+    // Lazily split the range, leaving the upper halves to be stolen by idle threads.
+    Job& job = *task.job;
+    while (task.end - task.begin > job.grain) {
+        const size_t mid = task.begin + (task.end - task.begin) / 2;
+        push(deque_index, { &job, mid, task.end });
+        task.end = mid;
+    }
+    try {
+        for (size_t i = task.begin; i < task.end && !job.failed.load(std::memory_order_relaxed); ++i) {
+            job.func(i);
+        }
+    } catch (...) {
+        std::unique_lock<std::mutex> lock(job.exception_mutex);
+        if (!job.exception) {
+            job.exception = std::current_exception();
+        }
+        job.failed.store(true, std::memory_order_relaxed);
+    }
+    // The chunk retires even if it threw, otherwise the caller would wait on it forever. The job lives on the caller's
+    // stack, so it must not be touched after this.
+    job.remaining.fetch_sub(task.end - task.begin, std::memory_order_acq_rel);
+}
+
+void WorkStealingScheduler::run(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    const size_t deque_index = worker_index == NOT_A_WORKER ? injection_index() : worker_index;
+
+    const size_t grain = std::max<size_t>(1, num_iterations / ((workers.size() + 1) * CHUNKS_PER_THREAD));
+    Job job{ func, grain, num_iterations };
+    execute({ &job, 0, num_iterations }, deque_index);
+
+    // Help out until our job is done. Only tasks of this job are picked up here, tasks of other jobs are left to idle
+    // workers (or to their own callers, who are helping in the same way).
+    while (job.remaining.load(std::memory_order_acquire) != 0) {
+        if (auto task = find_task(deque_index, &job)) {
+            execute(*task, deque_index);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    if (job.exception) {
+        std::rethrow_exception(job.exception);
+    }
+}
+
+void WorkStealingScheduler::worker_loop(size_t thread_index)
+{
+    worker_index = thread_index;
+    while (true) {
+        if (auto task = find_task(thread_index)) {
+            execute(*task, thread_index);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleeping.fetch_add(1, std::memory_order_seq_cst);
+        sleep_condition.wait(lock, [this] { return stop || num_queued_tasks.load(std::memory_order_seq_cst) > 0; });
+        num_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+        if (stop) {
+            break;
+        }
+    }
+}
+} // namespace
+
+namespace bb {
+/**
+ * A work-stealing strategy with per-thread deques. Unlike the global pools, parallel_for calls may be nested (the
+ * inner call is served by idle workers instead of throwing or deadlocking), and concurrent calls from independent
+ * threads each wait only for their own iterations. An exception thrown by `func` is propagated to the caller.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static WorkStealingScheduler scheduler(get_num_cpus() - 1);
+    scheduler.run(num_iterations, func);
+}
+} // namespace bb
+#endif
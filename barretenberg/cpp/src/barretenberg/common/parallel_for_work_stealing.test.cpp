@@ -0,0 +1,108 @@
+#ifndef NO_MULTITHREADING
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace bb {
+// Not exposed in thread.hpp, parallel_for dispatches to it.
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+
+using namespace bb;
+
+namespace {
+void expect_each_visited_once(const std::vector<std::atomic<size_t>>& counts)
+{
+    for (size_t i = 0; i < counts.size(); ++i) {
+        EXPECT_EQ(counts[i].load(), 1UL) << "index " << i;
+    }
+}
+} // namespace
+
+TEST(ParallelForWorkStealing, ZeroIterations)
+{
+    std::atomic<size_t> calls = 0;
+    parallel_for_work_stealing(0, [&](size_t) { calls++; });
+    EXPECT_EQ(calls.load(), 0UL);
+}
+
+TEST(ParallelForWorkStealing, SingleIteration)
+{
+    std::vector<std::atomic<size_t>> counts(1);
+    parallel_for_work_stealing(1, [&](size_t i) { counts[i]++; });
+    expect_each_visited_once(counts);
+}
+
+TEST(ParallelForWorkStealing, VisitsEveryIndexOnce)
+{
+    for (size_t num_iterations : { 2UL, 3UL, 63UL, 64UL, 65UL, 10007UL }) {
+        std::vector<std::atomic<size_t>> counts(num_iterations);
+        parallel_for_work_stealing(num_iterations, [&](size_t i) { counts[i]++; });
+        expect_each_visited_once(counts);
+    }
+}
+
+TEST(ParallelForWorkStealing, Nested)
+{
+    constexpr size_t num_outer = 17;
+    constexpr size_t num_inner = 1001;
+    std::vector<std::atomic<size_t>> counts(num_outer * num_inner);
+    parallel_for_work_stealing(num_outer, [&](size_t i) {
+        parallel_for_work_stealing(num_inner, [&](size_t j) { counts[i * num_inner + j]++; });
+    });
+    expect_each_visited_once(counts);
+}
+
+TEST(ParallelForWorkStealing, ConcurrentCallers)
+{
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_iterations = 5000;
+    std::vector<std::vector<std::atomic<size_t>>> counts(num_callers);
+    std::vector<std::thread> callers;
+    for (size_t c = 0; c < num_callers; ++c) {
+        counts[c] = std::vector<std::atomic<size_t>>(num_iterations);
+        callers.emplace_back([&, c] { parallel_for_work_stealing(num_iterations, [&](size_t i) { counts[c][i]++; }); });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (auto& caller_counts : counts) {
+        expect_each_visited_once(caller_counts);
+    }
+}
+
+TEST(ParallelForWorkStealing, PropagatesException)
+{
+    EXPECT_THROW(parallel_for_work_stealing(1000,
+                                            [](size_t i) {
+                                                if (i == 537) {
+                                                    throw std::runtime_error("iteration failed");
+                                                }
+                                            }),
+                 std::runtime_error);
+
+    // The scheduler is still usable afterwards.
+    std::vector<std::atomic<size_t>> counts(1000);
+    parallel_for_work_stealing(counts.size(), [&](size_t i) { counts[i]++; });
+    expect_each_visited_once(counts);
+}
+
+TEST(ParallelForWorkStealing, PropagatesExceptionFromNestedCall)
+{
+    std::atomic<size_t> outer_done = 0;
+    EXPECT_THROW(parallel_for_work_stealing(8,
+                                            [&](size_t i) {
+                                                parallel_for_work_stealing(100, [&](size_t j) {
+                                                    if (i == 5 && j == 42) {
+                                                        throw std::runtime_error("nested iteration failed");
+                                                    }
+                                                });
+                                                outer_done++;
+                                            }),
+                 std::runtime_error);
+    EXPECT_LT(outer_done.load(), 8UL);
+}
+#endif
@@ -34,6 +34,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the pools above are a single global job slot. A parallel_for issued from inside another one cannot
+ * use idle workers (mutex_pool aborts outright), and two provers in one process serialise on the same pool.
+ * "work_stealing" keeps a deque per worker, lets the caller help with its own (and nested) work, and gives every call
+ * its own completion state. Defaulting to work_stealing.
  */
 
 namespace bb {
@@ -69,6 +74,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,7 +89,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
 #endif
 #endif
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::crypto {
+
+/**
+ * @brief Precomputed multiples of a fixed generator point, for native scalar multiplications by that generator
+ *
+ * @details The scalar is split into NUM_WINDOWS windows of WINDOW_BITS bits each, and for every window `j` and nonzero
+ *          digit `d` the table stores the affine point `d * 2^(WINDOW_BITS * j) * [G]`. A scalar multiplication is then
+ *          a sum of one table entry per nonzero window: no doublings, and at most NUM_WINDOWS mixed additions.
+ *
+ *          A table takes NUM_WINDOWS * (WINDOW_SIZE - 1) affine points (~60KB for Grumpkin), and costs about as much as
+ *          a dozen variable-base multiplications to build, so it only pays off for generators that are used
+ *          repeatedly (e.g. the Pedersen generators, see `generator_data::get_fixed_base_tables`).
+ *
+ * @tparam Curve
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Group = typename Curve::Group;
+
+    static constexpr size_t WINDOW_BITS = 4;
+    static constexpr size_t WINDOW_SIZE = 1UL << WINDOW_BITS;
+    static constexpr size_t NUM_WINDOWS = 256 / WINDOW_BITS;
+    static_assert(64 % WINDOW_BITS == 0, "Windows must not straddle the limbs of a uint256_t");
+
+    explicit FixedBaseTable(const AffineElement& generator)
+    {
+        std::vector<Element> multiples;
+        multiples.reserve(NUM_WINDOWS * (WINDOW_SIZE - 1));
+        Element window_base(generator);
+        for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+            Element multiple = window_base;
+            for (size_t digit = 1; digit < WINDOW_SIZE; ++digit) {
+                multiples.emplace_back(multiple);
+                multiple += window_base;
+            }
+            // multiple = WINDOW_SIZE * window_base, i.e. the base of the next window
+            window_base = multiple;
+        }
+        Element::batch_normalize(multiples.data(), multiples.size());
+
+        points.reserve(multiples.size());
+        for (const auto& multiple : multiples) {
+            points.emplace_back(multiple.x, multiple.y);
+        }
+    }
+
+    /**
+     * @brief Compute scalar * [G]
+     */
+    Element mul(const uint256_t& scalar) const
+    {
+        constexpr size_t WINDOWS_PER_LIMB = 64 / WINDOW_BITS;
+        Element result = Group::point_at_infinity;
+        for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+            const uint64_t limb = scalar.data[window / WINDOWS_PER_LIMB];
+            const uint64_t digit = (limb >> ((window % WINDOWS_PER_LIMB) * WINDOW_BITS)) & (WINDOW_SIZE - 1);
+            if (digit != 0) {
+                result += points[(window * (WINDOW_SIZE - 1)) + digit - 1];
+            }
+        }
+        return result;
+    }
+
+  private:
+    // points[j * (WINDOW_SIZE - 1) + d - 1] = d * 2^(WINDOW_BITS * j) * [G]
+    std::vector<AffineElement> points;
+};
+
+} // namespace bb::crypto
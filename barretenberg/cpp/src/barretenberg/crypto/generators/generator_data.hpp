@@ -1,10 +1,13 @@
 #pragma once
 
+#include "./fixed_base_table.hpp"
 #include "barretenberg/common/container.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <deque>
 #include <map>
+#include <mutex>
 #include <optional>
 
 namespace bb::crypto {
@@ -45,6 +48,9 @@ template <typename Curve> class generator_data {
     using GeneratorView = std::span<AffineElement const>;
     static inline constexpr size_t DEFAULT_NUM_GENERATORS = 8;
     static inline constexpr std::string_view DEFAULT_DOMAIN_SEPARATOR = "DEFAULT_DOMAIN_SEPARATOR";
+    // Bounds on the fixed-base tables cached by `get_fixed_base_tables`, about 8MB in total
+    static inline constexpr size_t MAX_FIXED_BASE_TABLE_GENERATORS = 32;
+    static inline constexpr size_t MAX_FIXED_BASE_TABLE_DOMAINS = 4;
     inline constexpr generator_data() = default;
 
     static inline constexpr std::array<AffineElement, DEFAULT_NUM_GENERATORS> make_precomputed_generators()
@@ -106,6 +112,62 @@ template <typename Curve> class generator_data {
         return GeneratorView{ generators.data() + generator_offset, num_generators };
     }
 
+    /**
+     * @brief Get fixed-base tables for the generators that `get` returns for the same arguments
+     *
+     * @details Tables are built lazily, the first time a generator is used this way, and are then cached per domain
+     *          separator. A table is ~60KB and is never freed, so only the first MAX_FIXED_BASE_TABLE_GENERATORS
+     *          generators of at most MAX_FIXED_BASE_TABLE_DOMAINS domain separators get one: that covers the small,
+     *          heavily reused generator sets (Merkle hashes, note commitments, ...). For anything else std::nullopt is
+     *          returned and the caller falls back to variable-base multiplications.
+     *
+     *          Unlike `get`, this method is thread-safe: the generators are derived independently of `generator_map`,
+     *          the cache is guarded by a mutex, and cached tables are never moved, so the returned pointers stay valid
+     *          while more tables are added.
+     */
+    [[nodiscard]] std::optional<std::vector<const FixedBaseTable<Curve>*>> get_fixed_base_tables(
+        const size_t num_generators,
+        const size_t generator_offset = 0,
+        const std::string_view domain_separator = DEFAULT_DOMAIN_SEPARATOR) const
+    {
+        const size_t num_tables_needed = num_generators + generator_offset;
+        if (num_tables_needed > MAX_FIXED_BASE_TABLE_GENERATORS) {
+            return std::nullopt;
+        }
+
+        std::lock_guard<std::mutex> lock(fixed_base_tables_mutex);
+        if (!fixed_base_table_map.has_value()) {
+            fixed_base_table_map = std::map<std::string, std::deque<FixedBaseTable<Curve>>, std::less<>>();
+        }
+        auto it = fixed_base_table_map->find(domain_separator);
+        if (it == fixed_base_table_map->end()) {
+            if (fixed_base_table_map->size() >= MAX_FIXED_BASE_TABLE_DOMAINS) {
+                return std::nullopt;
+            }
+            it = fixed_base_table_map->emplace(std::string(domain_separator), std::deque<FixedBaseTable<Curve>>()).first;
+        }
+        std::deque<FixedBaseTable<Curve>>& tables = it->second;
+
+        // Tables are stored for generators [0, tables.size()), so extend them up to the last one requested
+        if (num_tables_needed > tables.size()) {
+            const bool is_default_domain = domain_separator == DEFAULT_DOMAIN_SEPARATOR;
+            const GeneratorList generators =
+                is_default_domain && num_tables_needed <= DEFAULT_NUM_GENERATORS
+                    ? GeneratorList(precomputed_generators.begin() + static_cast<std::ptrdiff_t>(tables.size()),
+                                    precomputed_generators.begin() + static_cast<std::ptrdiff_t>(num_tables_needed))
+                    : Group::derive_generators(domain_separator, num_tables_needed - tables.size(), tables.size());
+            for (const auto& generator : generators) {
+                tables.emplace_back(generator);
+            }
+        }
+
+        std::vector<const FixedBaseTable<Curve>*> result(num_generators);
+        for (size_t i = 0; i < num_generators; ++i) {
+            result[i] = &tables[generator_offset + i];
+        }
+        return result;
+    }
+
     // getter method for `default_data`. Object exists as a singleton so we don't need a smart pointer.
     // Don't call `delete` on this pointer.
     static inline generator_data* get_default_generators() { return &default_data; }
@@ -128,6 +190,11 @@ template <typename Curve> class generator_data {
     // We wrap the std::map in a `std::optional` so that we can construct `generator_data` at compile time.
     // This allows us to mark `default_data` as `constinit`, which prevents static initialization ordering fiasco
     mutable std::optional<std::map<std::string, GeneratorList>> generator_map = {};
+
+    // Fixed-base tables of the generators in `generator_map`, see `get_fixed_base_tables`
+    mutable std::optional<std::map<std::string, std::deque<FixedBaseTable<Curve>>, std::less<>>> fixed_base_table_map =
+        {};
+    mutable std::mutex fixed_base_tables_mutex;
 };
 
 template <typename Curve> struct GeneratorContext {
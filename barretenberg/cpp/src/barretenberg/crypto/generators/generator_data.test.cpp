@@ -1,6 +1,7 @@
 #include "generator_data.hpp"
 #include "barretenberg/crypto/pedersen_commitment/c_bind.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include <gtest/gtest.h>
 #include <vector>
 
@@ -42,4 +43,71 @@ TEST(GeneratorContext, DeriveDefaultGenerators)
     }
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+TEST(GeneratorContext, FixedBaseTableMatchesScalarMultiplication)
+{
+    using Curve = curve::Grumpkin;
+    using Element = Curve::Element;
+    auto& engine = numeric::get_debug_randomness();
+
+    const auto generator = generator_data<Curve>::precomputed_generators[3];
+    const FixedBaseTable<Curve> table(generator);
+
+    std::vector<uint256_t> scalars = { 0, 1, 15, 16, 255, uint256_t(Curve::BaseField::modulus - 1) };
+    for (size_t i = 0; i < 8; ++i) {
+        scalars.emplace_back(uint256_t(Curve::BaseField::random_element(&engine)));
+    }
+    for (const auto& scalar : scalars) {
+        Element expected = Element(generator) * scalar;
+        EXPECT_EQ(table.mul(scalar).normalize(), expected.normalize());
+    }
+}
+
+TEST(GeneratorContext, FixedBaseTablesAreCachedPerDomain)
+{
+    using Curve = curve::Grumpkin;
+    generator_data<Curve> data;
+
+    const auto tables = data.get_fixed_base_tables(3, 1, "FIXED_BASE_TABLES_TEST");
+    const auto generators = data.get(3, 1, "FIXED_BASE_TABLES_TEST");
+    ASSERT_TRUE(tables.has_value());
+    ASSERT_EQ(tables->size(), 3);
+    for (size_t i = 0; i < tables->size(); ++i) {
+        EXPECT_EQ((*tables)[i]->mul(1).normalize(), Curve::Element(generators[i]).normalize());
+    }
+
+    // Extending the cache must not move the tables handed out before
+    const auto more_tables = data.get_fixed_base_tables(10, 0, "FIXED_BASE_TABLES_TEST");
+    ASSERT_TRUE(more_tables.has_value());
+    for (size_t i = 0; i < tables->size(); ++i) {
+        EXPECT_EQ((*more_tables)[i + 1], (*tables)[i]);
+    }
+
+    // Default generators, partly precomputed, match too
+    const auto default_tables = data.get_fixed_base_tables(12);
+    const auto default_generators = data.get(12);
+    ASSERT_TRUE(default_tables.has_value());
+    for (size_t i = 0; i < default_tables->size(); ++i) {
+        EXPECT_EQ((*default_tables)[i]->mul(1).normalize(), Curve::Element(default_generators[i]).normalize());
+    }
+}
+
+TEST(GeneratorContext, FixedBaseTablesAreBounded)
+{
+    using Curve = curve::Grumpkin;
+    using Data = generator_data<Curve>;
+    Data data;
+
+    EXPECT_TRUE(data.get_fixed_base_tables(Data::MAX_FIXED_BASE_TABLE_GENERATORS).has_value());
+    EXPECT_FALSE(data.get_fixed_base_tables(Data::MAX_FIXED_BASE_TABLE_GENERATORS + 1).has_value());
+    EXPECT_FALSE(data.get_fixed_base_tables(1, Data::MAX_FIXED_BASE_TABLE_GENERATORS).has_value());
+
+    // The default domain takes one slot
+    for (size_t i = 1; i < Data::MAX_FIXED_BASE_TABLE_DOMAINS; ++i) {
+        EXPECT_TRUE(data.get_fixed_base_tables(1, 0, "FIXED_BASE_TABLES_DOMAIN_" + std::to_string(i)).has_value());
+    }
+    EXPECT_FALSE(data.get_fixed_base_tables(1, 0, "FIXED_BASE_TABLES_ONE_DOMAIN_TOO_MANY").has_value());
+    // Domains that are already cached keep being served
+    EXPECT_TRUE(data.get_fixed_base_tables(2, 0, "FIXED_BASE_TABLES_DOMAIN_1").has_value());
+}
+
+} // namespace bb::crypto
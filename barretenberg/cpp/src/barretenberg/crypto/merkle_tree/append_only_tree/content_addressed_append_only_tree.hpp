@@ -7,16 +7,23 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -44,6 +51,9 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     using HashPathCallback = std::function<void(const TypedResponse<GetSiblingPathResponse>&)>;
     using FindLeafCallback = std::function<void(const TypedResponse<FindLeafIndexResponse>&)>;
     using GetLeafCallback = std::function<void(const TypedResponse<GetLeafResponse>&)>;
+    using HashPathsCallback = std::function<void(const TypedResponse<GetSiblingPathsResponse>&)>;
+    using FindLeavesCallback = std::function<void(const TypedResponse<FindLeafIndicesResponse>&)>;
+    using GetLeavesCallback = std::function<void(const TypedResponse<GetLeavesResponse>&)>;
     using CommitCallback = std::function<void(const Response&)>;
     using RollbackCallback = std::function<void(const Response&)>;
     using RemoveHistoricBlockCallback = std::function<void(const Response&)>;
@@ -183,6 +193,55 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                               bool includeUncommitted,
                               const FindLeafCallback& on_completion) const;
 
+    /**
+     * @brief Returns the sibling paths of the leaves at the provided indices, in the order given
+     * @details The work is split across the thread pool. Each worker walks its share of the indices in sorted order,
+     * re-reading only the nodes below the point where a path diverges from the previous one.
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
+    /**
+     * @brief Returns the sibling paths of the leaves at the provided indices, as of the given block
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           const index_t& blockNumber,
+                           const HashPathsCallback& on_completion,
+                           bool includeUncommitted) const;
+
+    /**
+     * @brief Returns the leaf values at the provided indices, nullopt for those that are not present
+     */
+    void get_leaves(const std::vector<index_t>& indices,
+                    bool includeUncommitted,
+                    const GetLeavesCallback& on_completion) const;
+
+    /**
+     * @brief Returns the leaf values at the provided indices as of the given block
+     */
+    void get_leaves(const std::vector<index_t>& indices,
+                    const index_t& blockNumber,
+                    bool includeUncommitted,
+                    const GetLeavesCallback& on_completion) const;
+
+    /**
+     * @brief Returns the indices of the provided leaves, only considering indices from start_index onwards
+     */
+    void find_leaf_indices(const std::vector<typename Store::LeafType>& leaves,
+                           const index_t& start_index,
+                           bool includeUncommitted,
+                           const FindLeavesCallback& on_completion) const;
+
+    /**
+     * @brief Returns the indices of the provided leaves as of the given block
+     */
+    void find_leaf_indices(const std::vector<typename Store::LeafType>& leaves,
+                           const index_t& start_index,
+                           const index_t& blockNumber,
+                           bool includeUncommitted,
+                           const FindLeavesCallback& on_completion) const;
+
     /**
      * @brief Commit the tree to the backing store
      */
@@ -236,6 +295,43 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    using BatchReadFunc = std::function<void(
+        size_t start, size_t end, const RequestContext& requestContext, ReadTransaction& tx)>;
+
+    /**
+     * @brief Resolves the root to read from, then runs func over chunks of [0, num_items) across the thread pool
+     * @details LMDB read transactions can't be used by two threads at once, so each chunk opens its own. All chunks
+     * read from the same root.
+     */
+    void execute_batch_read(size_t num_items,
+                            const std::optional<index_t>& blockNumber,
+                            bool includeUncommitted,
+                            const BatchReadFunc& func) const;
+
+    void get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                    const std::optional<index_t>& blockNumber,
+                                    bool includeUncommitted,
+                                    const HashPathsCallback& on_completion) const;
+
+    void get_leaves_internal(const std::vector<index_t>& indices,
+                             const std::optional<index_t>& blockNumber,
+                             bool includeUncommitted,
+                             const GetLeavesCallback& on_completion) const;
+
+    void find_leaf_indices_internal(const std::vector<typename Store::LeafType>& leaves,
+                                    const index_t& start_index,
+                                    const std::optional<index_t>& blockNumber,
+                                    bool includeUncommitted,
+                                    const FindLeavesCallback& on_completion) const;
+
+    /**
+     * @brief Runs func(start, end) over chunks of [0, num_items) on the tree's thread pool
+     * @details The calling thread works through chunks as well and only returns once every chunk is done, so this is
+     * safe to call from a job that is itself running on the pool, even if the pool is busy or has a single thread. The
+     * first exception thrown by func is rethrown on the calling thread.
+     */
+    void parallel_for_workers(size_t num_items, const std::function<void(size_t, size_t)>& func) const;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -688,6 +784,204 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_index_from(
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    get_sibling_paths_internal(indices, std::nullopt, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                                             const index_t& blockNumber,
+                                                                             const HashPathsCallback& on_completion,
+                                                                             bool includeUncommitted) const
+{
+    get_sibling_paths_internal(indices, blockNumber, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& indices,
+    const std::optional<index_t>& blockNumber,
+    bool includeUncommitted,
+    const HashPathsCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathsResponse>(
+            [=, this](TypedResponse<GetSiblingPathsResponse>& response) {
+                // Visit the indices in sorted order so that neighbouring paths share their upper nodes
+                std::vector<size_t> order(indices.size());
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return indices[a] < indices[b]; });
+                response.inner.paths.resize(indices.size());
+
+                execute_batch_read(
+                    indices.size(),
+                    blockNumber,
+                    includeUncommitted,
+                    [&](size_t start, size_t end, const RequestContext& requestContext, ReadTransaction& tx) {
+                        // The nodes on the path of the previous index, payloads[level] being the node at that level
+                        std::vector<NodePayload> payloads(depth_);
+                        OptionalSiblingPath path(depth_);
+                        size_t valid_levels = 0;
+                        index_t previous_index = 0;
+                        for (size_t i = start; i < end; ++i) {
+                            const index_t leaf_index = indices[order[i]];
+                            if (i != start) {
+                                // The paths agree down to the level where the indices first differ, the node at that
+                                // level is shared but we now take its other child
+                                const index_t diff = leaf_index ^ previous_index;
+                                valid_levels = diff == 0 ? depth_ : depth_ - numeric::get_msb(diff);
+                                valid_levels = std::min<size_t>(valid_levels, depth_);
+                            }
+                            fr hash = requestContext.root;
+                            for (uint32_t level = 0; level < depth_; ++level) {
+                                if (level >= valid_levels) {
+                                    payloads[level] = NodePayload{};
+                                    store_->get_node_by_hash(
+                                        hash, payloads[level], tx, requestContext.includeUncommitted);
+                                }
+                                const NodePayload& nodePayload = payloads[level];
+                                bool is_right = static_cast<bool>((leaf_index >> (depth_ - 1 - level)) & 1);
+                                std::optional<fr> sibling = is_right ? nodePayload.left : nodePayload.right;
+                                std::optional<fr> child = is_right ? nodePayload.right : nodePayload.left;
+                                hash = child.has_value() ? child.value() : zero_hashes_[level + 1];
+                                path[depth_ - 1 - level] = sibling;
+                            }
+                            response.inner.paths[order[i]] = optional_sibling_path_to_full_sibling_path(path);
+                            previous_index = leaf_index;
+                        }
+                    });
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_leaves(const std::vector<index_t>& indices,
+                                                                      bool includeUncommitted,
+                                                                      const GetLeavesCallback& on_completion) const
+{
+    get_leaves_internal(indices, std::nullopt, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_leaves(const std::vector<index_t>& indices,
+                                                                      const index_t& blockNumber,
+                                                                      bool includeUncommitted,
+                                                                      const GetLeavesCallback& on_completion) const
+{
+    get_leaves_internal(indices, blockNumber, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_leaves_internal(
+    const std::vector<index_t>& indices,
+    const std::optional<index_t>& blockNumber,
+    bool includeUncommitted,
+    const GetLeavesCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetLeavesResponse>(
+            [=, this](TypedResponse<GetLeavesResponse>& response) {
+                response.inner.leaves.resize(indices.size());
+                execute_batch_read(
+                    indices.size(),
+                    blockNumber,
+                    includeUncommitted,
+                    [&](size_t start, size_t end, const RequestContext& requestContext, ReadTransaction& tx) {
+                        for (size_t i = start; i < end; ++i) {
+                            response.inner.leaves[i] = find_leaf_hash(indices[i], requestContext, tx);
+                        }
+                    });
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_indices(
+    const std::vector<typename Store::LeafType>& leaves,
+    const index_t& start_index,
+    bool includeUncommitted,
+    const FindLeavesCallback& on_completion) const
+{
+    find_leaf_indices_internal(leaves, start_index, std::nullopt, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_indices(
+    const std::vector<typename Store::LeafType>& leaves,
+    const index_t& start_index,
+    const index_t& blockNumber,
+    bool includeUncommitted,
+    const FindLeavesCallback& on_completion) const
+{
+    find_leaf_indices_internal(leaves, start_index, blockNumber, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_indices_internal(
+    const std::vector<typename Store::LeafType>& leaves,
+    const index_t& start_index,
+    const std::optional<index_t>& blockNumber,
+    bool includeUncommitted,
+    const FindLeavesCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<FindLeafIndicesResponse>(
+            [=, this](TypedResponse<FindLeafIndicesResponse>& response) {
+                response.inner.leaf_indices.resize(leaves.size());
+                execute_batch_read(
+                    leaves.size(),
+                    blockNumber,
+                    includeUncommitted,
+                    [&](size_t start, size_t end, const RequestContext& requestContext, ReadTransaction& tx) {
+                        for (size_t i = start; i < end; ++i) {
+                            response.inner.leaf_indices[i] = store_->find_leaf_index_from(
+                                leaves[i], start_index, requestContext, tx, includeUncommitted);
+                        }
+                    });
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::execute_batch_read(size_t num_items,
+                                                                              const std::optional<index_t>& blockNumber,
+                                                                              bool includeUncommitted,
+                                                                              const BatchReadFunc& func) const
+{
+    RequestContext requestContext;
+    requestContext.includeUncommitted = includeUncommitted;
+    {
+        ReadTransactionPtr tx = store_->create_read_transaction();
+        if (blockNumber.has_value()) {
+            if (blockNumber.value() == 0) {
+                throw std::runtime_error("Invalid block number");
+            }
+            BlockPayload blockData;
+            if (!store_->get_block_data(blockNumber.value(), blockData, *tx)) {
+                throw std::runtime_error("Data for block unavailable");
+            }
+            requestContext.blockNumber = blockNumber;
+            requestContext.root = blockData.root;
+        } else {
+            requestContext.root = store_->get_current_root(*tx, includeUncommitted);
+        }
+    }
+    parallel_for_workers(num_items, [&](size_t start, size_t end) {
+        ReadTransactionPtr tx = store_->create_read_transaction();
+        func(start, end, requestContext, *tx);
+    });
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_value(const fr& value,
                                                                      const AppendCompletionCallback& on_completion)
@@ -825,6 +1119,70 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal(s
     }
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::parallel_for_workers(
+    size_t num_items, const std::function<void(size_t, size_t)>& func) const
+{
+    // Below this many items per chunk, handing work to another thread costs more than it saves
+    constexpr size_t MIN_ITEMS_PER_CHUNK = 16;
+    const size_t num_helpers = workers_->num_threads();
+    const size_t max_chunks = std::max<size_t>(num_items / MIN_ITEMS_PER_CHUNK, 1);
+    // Over-decompose so that helpers which start late, or share the pool with other trees, still balance out
+    const size_t num_chunks = std::min(max_chunks, (num_helpers + 1) * 4);
+    if (num_chunks == 1) {
+        func(0, num_items);
+        return;
+    }
+
+    // Helpers may only get scheduled after this call has returned, so the shared state must outlive it. A late helper
+    // finds no chunk left to claim and never touches func.
+    struct SharedState {
+        const std::function<void(size_t, size_t)>* func;
+        size_t num_items;
+        size_t num_chunks;
+        std::atomic<size_t> next_chunk = 0;
+        std::atomic<size_t> chunks_done = 0;
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::exception_ptr error;
+
+        void run_chunks()
+        {
+            size_t completed = 0;
+            for (size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++) {
+                try {
+                    (*func)(chunk * num_items / num_chunks, (chunk + 1) * num_items / num_chunks);
+                } catch (...) {
+                    std::unique_lock lock(mtx);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                ++completed;
+            }
+            if (completed > 0 && chunks_done.fetch_add(completed) + completed == num_chunks) {
+                std::unique_lock lock(mtx);
+                cv.notify_all();
+            }
+        }
+    };
+    auto state = std::make_shared<SharedState>();
+    state->func = &func;
+    state->num_items = num_items;
+    state->num_chunks = num_chunks;
+
+    for (size_t i = 0; i < std::min(num_helpers, num_chunks - 1); ++i) {
+        workers_->enqueue([state]() { state->run_chunks(); });
+    }
+    state->run_chunks();
+
+    std::unique_lock lock(state->mtx);
+    state->cv.wait(lock, [&]() { return state->chunks_done == state->num_chunks; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx)
@@ -849,12 +1207,7 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     }
 
     // Add the values at the leaf nodes of the tree
-    for (uint32_t i = 0; i < number_to_insert; ++i) {
-        // write_node(level, index + i, hashes_local[i]);
-        // std::cout << "Writing leaf hash: " << hashes_local[i] << " level " << level << std::endl;
-        store_->put_node_by_hash(hashes_local[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
-        store_->put_cached_node_by_index(level, i + index, hashes_local[i]);
-    }
+    store_->put_nodes_at_level(level, index, hashes_local, {});
 
     // If we have been told to add these leaves to the index then do so now
     if (update_index) {
@@ -864,25 +1217,27 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them. Each level is hashed in parallel from one buffer into the other,
+    // then written to the store in bulk
+    std::vector<fr> parents_buffer(number_to_insert / 2);
+    std::span<fr> children(hashes_local);
+    std::span<fr> parents(parents_buffer);
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
         // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
-        }
+        std::span<fr> level_hashes = parents.first(number_to_insert);
+        std::span<const fr> level_children = children.first(static_cast<size_t>(number_to_insert) * 2);
+        parallel_for_workers(number_to_insert, [&](size_t start, size_t end) {
+            HashingPolicy::hash_pairs(level_children.subspan(start * 2, (end - start) * 2),
+                                      level_hashes.subspan(start, end - start));
+        });
+        store_->put_nodes_at_level(level, index, level_hashes, level_children);
+        std::swap(children, parents);
     }
 
-    fr new_hash = hashes_local[0];
+    fr new_hash = children[0];
 
     // std::cout << "LEVEL: " << level << " hash " << new_hash << std::endl;
     RequestContext requestContext;
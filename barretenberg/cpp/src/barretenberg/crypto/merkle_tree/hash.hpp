@@ -8,6 +8,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -17,6 +18,13 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    // outputs[i] = hash_pair(inputs[2i], inputs[2i + 1])
+    static void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+    {
+        const std::vector<fr> hashes = crypto::pedersen_hash::hash_batch(inputs.first(2 * outputs.size()), 2);
+        std::copy(hashes.begin(), hashes.end(), outputs.begin());
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -26,7 +34,16 @@ struct Poseidon2HashPolicy {
         return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    static fr hash_pair(const fr& lhs, const fr& rhs)
+    {
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pair(lhs, rhs);
+    }
+
+    // outputs[i] = hash_pair(inputs[2i], inputs[2i + 1])
+    static void hash_pairs(std::span<const fr> inputs, std::span<fr> outputs)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_pairs(inputs, outputs);
+    }
 
     static fr zero_hash() { return fr::zero(); }
 };
@@ -55,9 +72,7 @@ inline bb::fr compute_tree_root_native(std::vector<bb::fr> const& input)
     auto layer = input;
     while (layer.size() > 1) {
         std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-        }
+        PedersenHashPolicy::hash_pairs(layer, next_layer);
         layer = std::move(next_layer);
     }
 
@@ -74,10 +89,8 @@ inline std::vector<bb::fr> compute_tree_native(std::vector<bb::fr> const& input)
     std::vector<bb::fr> tree(input);
     while (layer.size() > 1) {
         std::vector<bb::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::hash({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
+        PedersenHashPolicy::hash_pairs(layer, next_layer);
+        tree.insert(tree.end(), next_layer.begin(), next_layer.end());
         layer = std::move(next_layer);
     }
 
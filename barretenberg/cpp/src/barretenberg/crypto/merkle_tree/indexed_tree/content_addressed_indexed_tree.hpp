@@ -52,6 +52,8 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     using AddCompletionCallback = std::function<void(const TypedResponse<AddDataResponse>&)>;
     using LeafCallback = std::function<void(const TypedResponse<GetIndexedLeafResponse<LeafValueType>>&)>;
     using FindLowLeafCallback = std::function<void(const TypedResponse<GetLowIndexedLeafResponse>&)>;
+    using LeavesCallback = std::function<void(const TypedResponse<GetIndexedLeavesResponse<LeafValueType>>&)>;
+    using FindLowLeavesCallback = std::function<void(const TypedResponse<GetLowIndexedLeavesResponse>&)>;
 
     ContentAddressedIndexedTree(std::unique_ptr<Store> store,
                                 std::shared_ptr<ThreadPool> workers,
@@ -163,10 +165,44 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
                        bool includeUncommitted,
                        const FindLowLeafCallback& on_completion) const;
 
+    /**
+     * @brief Returns the leaves at the provided indices, nullopt for those that are not present
+     */
+    void get_leaves(const std::vector<index_t>& indices,
+                    bool includeUncommitted,
+                    const LeavesCallback& completion) const;
+
+    void get_leaves(const std::vector<index_t>& indices,
+                    const index_t& blockNumber,
+                    bool includeUncommitted,
+                    const LeavesCallback& completion) const;
+
+    /**
+     * @brief Find the low leaf of each of the provided keys, in the order given
+     */
+    void find_low_leaves(const std::vector<fr>& leaf_keys,
+                         bool includeUncommitted,
+                         const FindLowLeavesCallback& on_completion) const;
+
+    void find_low_leaves(const std::vector<fr>& leaf_keys,
+                         const index_t& blockNumber,
+                         bool includeUncommitted,
+                         const FindLowLeavesCallback& on_completion) const;
+
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path;
 
   private:
     using typename ContentAddressedAppendOnlyTree<Store, HashingPolicy>::AppendCompletionCallback;
+
+    void get_leaves_internal(const std::vector<index_t>& indices,
+                             const std::optional<index_t>& blockNumber,
+                             bool includeUncommitted,
+                             const LeavesCallback& completion) const;
+
+    void find_low_leaves_internal(const std::vector<fr>& leaf_keys,
+                                  const std::optional<index_t>& blockNumber,
+                                  bool includeUncommitted,
+                                  const FindLowLeavesCallback& on_completion) const;
     using ReadTransaction = typename Store::ReadTransaction;
     using ReadTransactionPtr = typename Store::ReadTransactionPtr;
 
@@ -246,6 +282,7 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_values_internal;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_hash;
+    using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::execute_batch_read;
 
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::store_;
     using ContentAddressedAppendOnlyTree<Store, HashingPolicy>::zero_hashes_;
@@ -526,6 +563,97 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaf(const fr&
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::get_leaves(const std::vector<index_t>& indices,
+                                                                   bool includeUncommitted,
+                                                                   const LeavesCallback& completion) const
+{
+    get_leaves_internal(indices, std::nullopt, includeUncommitted, completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::get_leaves(const std::vector<index_t>& indices,
+                                                                   const index_t& blockNumber,
+                                                                   bool includeUncommitted,
+                                                                   const LeavesCallback& completion) const
+{
+    get_leaves_internal(indices, blockNumber, includeUncommitted, completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::get_leaves_internal(const std::vector<index_t>& indices,
+                                                                            const std::optional<index_t>& blockNumber,
+                                                                            bool includeUncommitted,
+                                                                            const LeavesCallback& completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetIndexedLeavesResponse<LeafValueType>>(
+            [=, this](TypedResponse<GetIndexedLeavesResponse<LeafValueType>>& response) {
+                response.inner.indexed_leaves.resize(indices.size());
+                execute_batch_read(
+                    indices.size(),
+                    blockNumber,
+                    includeUncommitted,
+                    [&](size_t start, size_t end, const RequestContext& requestContext, ReadTransaction& tx) {
+                        for (size_t i = start; i < end; ++i) {
+                            std::optional<fr> leaf_hash = find_leaf_hash(indices[i], requestContext, tx);
+                            if (leaf_hash.has_value()) {
+                                response.inner.indexed_leaves[i] =
+                                    store_->get_leaf_by_hash(leaf_hash.value(), tx, includeUncommitted);
+                            }
+                        }
+                    });
+            },
+            completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaves(
+    const std::vector<fr>& leaf_keys, bool includeUncommitted, const FindLowLeavesCallback& on_completion) const
+{
+    find_low_leaves_internal(leaf_keys, std::nullopt, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaves(
+    const std::vector<fr>& leaf_keys,
+    const index_t& blockNumber,
+    bool includeUncommitted,
+    const FindLowLeavesCallback& on_completion) const
+{
+    find_low_leaves_internal(leaf_keys, blockNumber, includeUncommitted, on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedIndexedTree<Store, HashingPolicy>::find_low_leaves_internal(
+    const std::vector<fr>& leaf_keys,
+    const std::optional<index_t>& blockNumber,
+    bool includeUncommitted,
+    const FindLowLeavesCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetLowIndexedLeavesResponse>(
+            [=, this](TypedResponse<GetLowIndexedLeavesResponse>& response) {
+                response.inner.low_leaves.resize(leaf_keys.size());
+                execute_batch_read(
+                    leaf_keys.size(),
+                    blockNumber,
+                    includeUncommitted,
+                    [&](size_t start, size_t end, const RequestContext& requestContext, ReadTransaction& tx) {
+                        for (size_t i = start; i < end; ++i) {
+                            std::pair<bool, index_t> result = store_->find_low_value(leaf_keys[i], requestContext, tx);
+                            response.inner.low_leaves[i] = { .is_already_present = result.first,
+                                                             .index = result.second };
+                        }
+                    });
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::add_or_update_value(
     const LeafValueType& value, const AddCompletionCallbackWithWitness& completion)
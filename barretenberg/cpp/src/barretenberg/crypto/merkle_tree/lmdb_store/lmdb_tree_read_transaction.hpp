@@ -10,6 +10,7 @@
 #include <cstring>
 #include <exception>
 #include <functional>
+#include <utility>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -41,6 +42,9 @@ class LMDBTreeReadTransaction : public LMDBTransaction {
 
     template <typename T> bool get_value(T& key, std::vector<uint8_t>& data, const LMDBDatabase& db) const;
 
+    // Passes the value to on_value as a std::span<const uint8_t> over the memory map, see lmdb_queries::view_value
+    template <typename T, typename OnValue> bool view_value(T& key, const LMDBDatabase& db, OnValue&& on_value) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -63,6 +67,12 @@ bool LMDBTreeReadTransaction::get_value(T& key, std::vector<uint8_t>& data, cons
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T, typename OnValue>
+bool LMDBTreeReadTransaction::view_value(T& key, const LMDBDatabase& db, OnValue&& on_value) const
+{
+    return lmdb_queries::view_value(key, db, *this, std::forward<OnValue>(on_value));
+}
+
 template <typename T>
 bool LMDBTreeReadTransaction::get_value_or_previous(T& key, std::vector<uint8_t>& data, const LMDBDatabase& db) const
 {
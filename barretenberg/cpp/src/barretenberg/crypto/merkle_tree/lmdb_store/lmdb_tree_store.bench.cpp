@@ -0,0 +1,87 @@
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <vector>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+using bb::fr;
+
+namespace {
+
+const size_t NUM_NODES = 1 << 14;
+
+std::vector<NodePayload> random_node_payloads(size_t num_nodes)
+{
+    std::vector<NodePayload> payloads(num_nodes);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        payloads[i] = NodePayload{ .left = fr::random_element(), .right = fr::random_element(), .ref = i + 1 };
+    }
+    return payloads;
+}
+
+/**
+ * @brief Random reads of tree nodes through a read transaction, as done when computing sibling paths
+ */
+void read_node_bench(State& state) noexcept
+{
+    std::string directory = random_temp_directory();
+    std::filesystem::create_directories(directory);
+    {
+        LMDBTreeStore store(directory, "DB", 1024 * 1024, 2);
+        std::vector<fr> keys(NUM_NODES);
+        std::vector<NodePayload> payloads = random_node_payloads(NUM_NODES);
+        {
+            LMDBTreeWriteTransaction::Ptr tx = store.create_write_transaction();
+            for (size_t i = 0; i < NUM_NODES; ++i) {
+                keys[i] = fr::random_element();
+                store.write_node(keys[i], payloads[i], *tx);
+            }
+            tx->commit();
+        }
+
+        LMDBTreeReadTransaction::Ptr tx = store.create_read_transaction();
+        size_t i = 0;
+        for (auto _ : state) {
+            NodePayload payload;
+            DoNotOptimize(store.read_node(keys[i++ % NUM_NODES], payload, *tx));
+            DoNotOptimize(payload);
+        }
+    }
+    std::filesystem::remove_all(directory);
+}
+
+/**
+ * @brief Decoding cost of a single node payload, for the fixed-width layout (state.range(0) == 1) and for the msgpack
+ * encoding written by earlier versions of the store (state.range(0) == 0)
+ */
+void decode_node_payload_bench(State& state) noexcept
+{
+    std::vector<NodePayload> payloads = random_node_payloads(NUM_NODES);
+    std::vector<std::vector<uint8_t>> encoded(NUM_NODES);
+    for (size_t i = 0; i < NUM_NODES; ++i) {
+        if (state.range(0) == 1) {
+            encoded[i] = encode_node_payload(payloads[i]);
+        } else {
+            msgpack::sbuffer buffer;
+            msgpack::pack(buffer, payloads[i]);
+            encoded[i] = std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size());
+        }
+    }
+
+    size_t i = 0;
+    for (auto _ : state) {
+        NodePayload payload;
+        decode_node_payload(encoded[i++ % NUM_NODES], payload);
+        DoNotOptimize(payload);
+    }
+}
+
+} // namespace
+
+BENCHMARK(read_node_bench)->Unit(kNanosecond);
+BENCHMARK(decode_node_payload_bench)->Arg(0)->Arg(1)->Unit(kNanosecond);
+
+BENCHMARK_MAIN();
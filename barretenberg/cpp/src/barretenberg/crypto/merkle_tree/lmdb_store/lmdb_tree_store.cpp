@@ -14,6 +14,7 @@
 #include <exception>
 #include <lmdb.h>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +47,96 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
     return value_cmp<uint64_t>(a, b);
 }
 
+namespace {
+void write_fr(uint8_t* buf, const fr& value)
+{
+    const uint256_t canonical(value);
+    std::memcpy(buf, canonical.data, 32);
+}
+
+fr read_fr(const uint8_t* buf)
+{
+    uint256_t canonical;
+    std::memcpy(canonical.data, buf, 32);
+    return fr(canonical);
+}
+
+bool is_tagged_value(std::span<const uint8_t> data)
+{
+    if (data.empty() || data[0] != ENCODED_VALUE_TAG) {
+        return false;
+    }
+    if (data.size() < 2 || data[1] != ENCODED_VALUE_VERSION) {
+        throw std::runtime_error("Unsupported encoding version for tree store value");
+    }
+    return true;
+}
+} // namespace
+
+std::vector<uint8_t> encode_node_payload(const NodePayload& nodeData)
+{
+    std::vector<uint8_t> encoded(ENCODED_NODE_PAYLOAD_SIZE, 0);
+    encoded[0] = ENCODED_VALUE_TAG;
+    encoded[1] = ENCODED_VALUE_VERSION;
+    encoded[2] = static_cast<uint8_t>((nodeData.left.has_value() ? 1 : 0) | (nodeData.right.has_value() ? 2 : 0));
+    if (nodeData.left.has_value()) {
+        write_fr(&encoded[3], nodeData.left.value());
+    }
+    if (nodeData.right.has_value()) {
+        write_fr(&encoded[3 + 32], nodeData.right.value());
+    }
+    std::memcpy(&encoded[3 + 64], &nodeData.ref, sizeof(nodeData.ref));
+    return encoded;
+}
+
+void decode_node_payload(std::span<const uint8_t> data, NodePayload& nodeData)
+{
+    if (!is_tagged_value(data)) {
+        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        return;
+    }
+    if (data.size() != ENCODED_NODE_PAYLOAD_SIZE) {
+        throw std::runtime_error("Invalid size for encoded node payload");
+    }
+    const uint8_t flags = data[2];
+    nodeData.left = (flags & 1) != 0 ? std::optional<fr>(read_fr(&data[3])) : std::nullopt;
+    nodeData.right = (flags & 2) != 0 ? std::optional<fr>(read_fr(&data[3 + 32])) : std::nullopt;
+    std::memcpy(&nodeData.ref, &data[3 + 64], sizeof(nodeData.ref));
+}
+
+std::vector<uint8_t> encode_indices(const Indices& indices)
+{
+    const uint64_t count = indices.indices.size();
+    std::vector<uint8_t> encoded(ENCODED_INDICES_HEADER_SIZE + (count * sizeof(index_t)));
+    encoded[0] = ENCODED_VALUE_TAG;
+    encoded[1] = ENCODED_VALUE_VERSION;
+    std::memcpy(&encoded[2], &count, sizeof(count));
+    if (count != 0) {
+        std::memcpy(&encoded[ENCODED_INDICES_HEADER_SIZE], indices.indices.data(), count * sizeof(index_t));
+    }
+    return encoded;
+}
+
+void decode_indices(std::span<const uint8_t> data, Indices& indices)
+{
+    if (!is_tagged_value(data)) {
+        msgpack::unpack((const char*)data.data(), data.size()).get().convert(indices);
+        return;
+    }
+    if (data.size() < ENCODED_INDICES_HEADER_SIZE) {
+        throw std::runtime_error("Invalid size for encoded leaf indices");
+    }
+    uint64_t count = 0;
+    std::memcpy(&count, &data[2], sizeof(count));
+    if (data.size() - ENCODED_INDICES_HEADER_SIZE != count * sizeof(index_t)) {
+        throw std::runtime_error("Invalid size for encoded leaf indices");
+    }
+    indices.indices.resize(count);
+    if (count != 0) {
+        std::memcpy(indices.indices.data(), &data[ENCODED_INDICES_HEADER_SIZE], count * sizeof(index_t));
+    }
+}
+
 std::ostream& operator<<(std::ostream& os, const StatsMap& stats)
 {
     for (const auto& it : stats) {
@@ -174,9 +265,7 @@ bool LMDBTreeStore::read_meta_data(TreeMeta& metaData, LMDBTreeStore::ReadTransa
 
 void LMDBTreeStore::write_leaf_indices(const fr& leafValue, const Indices& indices, LMDBTreeStore::WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, indices);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = encode_indices(indices);
     FrKeyType key(leafValue);
     // std::cout << "Writing leaf indices by key " << key << std::endl;
     tx.put_value<FrKeyType>(key, encoded, *_leafValueToIndexDatabase);
@@ -244,15 +333,15 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
     FrKeyType key(leafValue);
     auto is_valid = [&](const std::vector<uint8_t>& data) {
         Indices tmp;
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(tmp);
+        decode_indices(data, tmp);
         return tmp.indices[0] < sizeLimit.value();
     };
     if (!sizeLimit.has_value()) {
         tx.get_value_or_previous(key, data, *_leafValueToIndexDatabase);
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(indices);
+        decode_indices(data, indices);
     } else {
         tx.get_value_or_previous(key, data, *_leafValueToIndexDatabase, is_valid);
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(indices);
+        decode_indices(data, indices);
     }
     return key;
 }
@@ -278,20 +367,12 @@ void LMDBTreeStore::delete_all_leaf_keys_before_or_equal_index(const index_t& in
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
-    FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
-    }
-    return success;
+    return get_node_data(nodeHash, nodeData, tx);
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = encode_node_payload(nodeData);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <optional>
 #include <ostream>
+#include <span>
 #include <string>
 #include <typeinfo>
 #include <unordered_map>
@@ -63,6 +64,27 @@ struct NodePayload {
     }
 };
 
+/**
+ * Nodes and leaf indices are read on every tree update and sibling path query, so they are stored in a fixed-width
+ * binary layout rather than msgpack and decoded straight out of the memory map. Encoded values start with
+ * ENCODED_VALUE_TAG, a byte msgpack never emits (0xc1 is reserved by the msgpack spec), followed by the layout version.
+ * Values without the tag were written by earlier versions of the store and are decoded as msgpack, so existing
+ * databases remain readable and are migrated entry by entry as they are rewritten.
+ */
+constexpr uint8_t ENCODED_VALUE_TAG = 0xc1;
+constexpr uint8_t ENCODED_VALUE_VERSION = 1;
+
+// tag | version | presence flags | left (32 bytes) | right (32 bytes) | ref (8 bytes)
+constexpr size_t ENCODED_NODE_PAYLOAD_SIZE = 3 + 32 + 32 + 8;
+// tag | version | count (8 bytes) | count * index (8 bytes each)
+constexpr size_t ENCODED_INDICES_HEADER_SIZE = 2 + 8;
+
+std::vector<uint8_t> encode_node_payload(const NodePayload& nodeData);
+void decode_node_payload(std::span<const uint8_t> data, NodePayload& nodeData);
+
+std::vector<uint8_t> encode_indices(const Indices& indices);
+void decode_indices(std::span<const uint8_t> data, Indices& indices);
+
 struct DBStats {
     std::string name;
     uint64_t mapSize;
@@ -196,24 +218,17 @@ class LMDBTreeStore {
 template <typename TxType> bool LMDBTreeStore::read_leaf_indices(const fr& leafValue, Indices& indices, TxType& tx)
 {
     FrKeyType key(leafValue);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_leafValueToIndexDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(indices);
-    }
-    return success;
+    return tx.template view_value<FrKeyType>(
+        key, *_leafValueToIndexDatabase, [&](std::span<const uint8_t> data) { decode_indices(data, indices); });
 }
 
 template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
-    if (success) {
+    return tx.template view_value<FrKeyType>(key, *_leafHashToPreImageDatabase, [&](std::span<const uint8_t> data) {
         msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
-    }
-    return success;
+    });
 }
 
 template <typename LeafType>
@@ -229,12 +244,8 @@ void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafD
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
-    }
-    return success;
+    return tx.template view_value<FrKeyType>(
+        key, *_nodeDatabase, [&](std::span<const uint8_t> data) { decode_node_payload(data, nodeData); });
 }
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_key_by_index(const index_t& index, fr& leafKey, TxType& tx)
@@ -178,6 +178,104 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes_without_children)
+{
+    std::vector<NodePayload> payloads = {
+        NodePayload{ .left = std::nullopt, .right = std::nullopt, .ref = 1 },
+        NodePayload{ .left = VALUES[1], .right = std::nullopt, .ref = 2 },
+        NodePayload{ .left = std::nullopt, .right = VALUES[2], .ref = 3 },
+    };
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    {
+        LMDBTreeWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (size_t i = 0; i < payloads.size(); i++) {
+            store.write_node(VALUES[10 + i], payloads[i], *transaction);
+        }
+        transaction->commit();
+    }
+
+    {
+        LMDBTreeReadTransaction::Ptr transaction = store.create_read_transaction();
+        for (size_t i = 0; i < payloads.size(); i++) {
+            NodePayload readBack;
+            bool success = store.read_node(VALUES[10 + i], readBack, *transaction);
+            EXPECT_TRUE(success);
+            EXPECT_EQ(readBack, payloads[i]);
+        }
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, node_payloads_are_encoded_with_a_fixed_width)
+{
+    NodePayload full{ .left = VALUES[0], .right = VALUES[1], .ref = 0xdeadbeefcafe };
+    NodePayload empty{ .left = std::nullopt, .right = std::nullopt, .ref = 0 };
+
+    std::vector<uint8_t> encodedFull = encode_node_payload(full);
+    std::vector<uint8_t> encodedEmpty = encode_node_payload(empty);
+    EXPECT_EQ(encodedFull.size(), ENCODED_NODE_PAYLOAD_SIZE);
+    EXPECT_EQ(encodedEmpty.size(), ENCODED_NODE_PAYLOAD_SIZE);
+    EXPECT_EQ(encodedFull[0], ENCODED_VALUE_TAG);
+    EXPECT_EQ(encodedFull[1], ENCODED_VALUE_VERSION);
+
+    NodePayload decoded;
+    decode_node_payload(encodedFull, decoded);
+    EXPECT_EQ(decoded, full);
+    decode_node_payload(encodedEmpty, decoded);
+    EXPECT_EQ(decoded, empty);
+
+    // An unknown layout version or a truncated value must not be silently misread
+    std::vector<uint8_t> unknownVersion = encodedFull;
+    unknownVersion[1] = ENCODED_VALUE_VERSION + 1;
+    EXPECT_THROW(decode_node_payload(unknownVersion, decoded), std::runtime_error);
+    std::vector<uint8_t> truncated(encodedFull.begin(), encodedFull.end() - 1);
+    EXPECT_THROW(decode_node_payload(truncated, decoded), std::runtime_error);
+}
+
+TEST_F(LMDBTreeStoreTest, leaf_indices_round_trip_through_encoding)
+{
+    for (size_t count : { 0UL, 1UL, 5UL }) {
+        Indices indices;
+        for (size_t i = 0; i < count; i++) {
+            indices.indices.push_back((i * 1000003) + 7);
+        }
+        std::vector<uint8_t> encoded = encode_indices(indices);
+        EXPECT_EQ(encoded.size(), ENCODED_INDICES_HEADER_SIZE + (count * sizeof(index_t)));
+        Indices decoded;
+        decode_indices(encoded, decoded);
+        EXPECT_EQ(decoded, indices);
+
+        std::vector<uint8_t> truncated(encoded.begin(), encoded.end() - 1);
+        EXPECT_THROW(decode_indices(truncated, decoded), std::runtime_error);
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, can_decode_legacy_msgpack_values)
+{
+    // Databases written before the fixed-width layout hold msgpack encoded nodes and indices
+    auto pack = [](const auto& value) {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, value);
+        return std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size());
+    };
+
+    for (const NodePayload& payload : { NodePayload{ .left = VALUES[3], .right = VALUES[4], .ref = 9 },
+                                        NodePayload{ .left = std::nullopt, .right = VALUES[4], .ref = 1 } }) {
+        std::vector<uint8_t> legacy = pack(payload);
+        EXPECT_NE(legacy[0], ENCODED_VALUE_TAG);
+        NodePayload decoded;
+        decode_node_payload(legacy, decoded);
+        EXPECT_EQ(decoded, payload);
+    }
+
+    Indices indices;
+    indices.indices = { 3, 1ULL << 40 };
+    std::vector<uint8_t> legacy = pack(indices);
+    EXPECT_NE(legacy[0], ENCODED_VALUE_TAG);
+    Indices decoded;
+    decode_indices(legacy, decoded);
+    EXPECT_EQ(decoded, indices);
+}
+
 TEST_F(LMDBTreeStoreTest, can_read_write_key_by_index)
 {
     bb::fr leafKey = VALUES[0];
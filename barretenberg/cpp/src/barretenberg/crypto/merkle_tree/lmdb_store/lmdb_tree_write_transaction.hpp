@@ -9,6 +9,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <exception>
+#include <utility>
 
 namespace bb::crypto::merkle_tree {
 
@@ -42,6 +43,9 @@ class LMDBTreeWriteTransaction : public LMDBTransaction {
     // This could be rationalised to prevent the duplication
     template <typename T> bool get_value(T& key, std::vector<uint8_t>& data, const LMDBDatabase& db) const;
 
+    // Passes the value to on_value as a std::span<const uint8_t> over the memory map, see lmdb_queries::view_value
+    template <typename T, typename OnValue> bool view_value(T& key, const LMDBDatabase& db, OnValue&& on_value) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -70,6 +74,12 @@ bool LMDBTreeWriteTransaction::get_value(T& key, std::vector<uint8_t>& data, con
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T, typename OnValue>
+bool LMDBTreeWriteTransaction::view_value(T& key, const LMDBDatabase& db, OnValue&& on_value) const
+{
+    return lmdb_queries::view_value(key, db, *this, std::forward<OnValue>(on_value));
+}
+
 template <typename T>
 void LMDBTreeWriteTransaction::put_value(T& key, std::vector<uint8_t>& data, const LMDBDatabase& db)
 {
@@ -5,9 +5,31 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree::lmdb_queries {
+
+/**
+ * Looks up the value stored against the given key and passes it to on_value without copying it out of the memory map.
+ * The span is only valid for the duration of the callback, values that must outlive it need to be decoded or copied.
+ */
+template <typename TKey, typename TxType, typename OnValue>
+bool view_value(TKey& key, const LMDBDatabase& db, const TxType& tx, OnValue&& on_value)
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    MDB_val dbKey;
+    dbKey.mv_size = keyBuffer.size();
+    dbKey.mv_data = (void*)keyBuffer.data();
+
+    MDB_val dbVal;
+    if (!call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &dbVal)) {
+        return false;
+    }
+    on_value(std::span<const uint8_t>(static_cast<const uint8_t*>(dbVal.mv_data), dbVal.mv_size));
+    return true;
+}
+
 template <typename TKey, typename TxType>
 bool get_value_or_previous(TKey& key, std::vector<uint8_t>& data, const LMDBDatabase& db, const TxType& tx)
 {
@@ -15,6 +15,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -127,6 +128,16 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     void put_cached_node_by_index(uint32_t level, index_t index, const fr& data, bool overwriteIfPresent = true);
 
+    /**
+     * @brief Writes a contiguous run of nodes at the given level, taking the lock once. hashes[i] is the node at index
+     * start_index + i. If children is empty the nodes are leaves, otherwise the children of hashes[i] are
+     * children[2i] and children[2i + 1]. Only writes to uncommitted data.
+     */
+    void put_nodes_at_level(uint32_t level,
+                            index_t start_index,
+                            std::span<const fr> hashes,
+                            std::span<const fr> children);
+
     /**
      * @brief Returns the data at the given node coordinates if available.
      */
@@ -538,6 +549,28 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(ui
     nodes_by_index_[level][index] = data;
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::put_nodes_at_level(uint32_t level,
+                                                                        index_t start_index,
+                                                                        std::span<const fr> hashes,
+                                                                        std::span<const fr> children)
+{
+    const bool is_leaf_level = children.empty();
+    // Accessing nodes_ and nodes_by_index_ under a lock
+    std::unique_lock lock(mtx_);
+    auto& level_map = nodes_by_index_[level];
+    nodes_.reserve(nodes_.size() + hashes.size());
+    level_map.reserve(level_map.size() + hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        if (is_leaf_level) {
+            nodes_[hashes[i]] = { .left = std::nullopt, .right = std::nullopt, .ref = 1 };
+        } else {
+            nodes_[hashes[i]] = { .left = children[2 * i], .right = children[2 * i + 1], .ref = 1 };
+        }
+        level_map[start_index + i] = hashes[i];
+    }
+}
+
 template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(uint32_t level,
                                                                               index_t index,
@@ -11,6 +11,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 struct TreeMetaResponse {
@@ -26,6 +27,10 @@ struct GetSiblingPathResponse {
     fr_sibling_path path;
 };
 
+struct GetSiblingPathsResponse {
+    std::vector<fr_sibling_path> paths;
+};
+
 template <typename LeafType> struct LowLeafWitnessData {
     IndexedLeaf<LeafType> leaf;
     index_t index;
@@ -45,14 +50,26 @@ struct FindLeafIndexResponse {
     index_t leaf_index;
 };
 
+struct FindLeafIndicesResponse {
+    std::vector<std::optional<index_t>> leaf_indices;
+};
+
 struct GetLeafResponse {
     std::optional<bb::fr> leaf;
 };
 
+struct GetLeavesResponse {
+    std::vector<std::optional<bb::fr>> leaves;
+};
+
 template <typename LeafValueType> struct GetIndexedLeafResponse {
     std::optional<IndexedLeaf<LeafValueType>> indexed_leaf;
 };
 
+template <typename LeafValueType> struct GetIndexedLeavesResponse {
+    std::vector<std::optional<IndexedLeaf<LeafValueType>>> indexed_leaves;
+};
+
 struct GetLowIndexedLeafResponse {
     bool is_already_present;
     index_t index;
@@ -65,6 +82,10 @@ struct GetLowIndexedLeafResponse {
     }
 };
 
+struct GetLowIndexedLeavesResponse {
+    std::vector<GetLowIndexedLeafResponse> low_leaves;
+};
+
 template <typename ResponseType> struct TypedResponse {
     ResponseType inner;
     bool success{ true };
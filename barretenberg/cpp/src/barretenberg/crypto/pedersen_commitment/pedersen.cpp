@@ -1,4 +1,5 @@
 #include "./pedersen.hpp"
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
@@ -21,13 +22,56 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
+    if (const auto tables =
+            context.generators->get_fixed_base_tables(inputs.size(), context.offset, context.domain_separator)) {
+        return commit_native(inputs, *tables).normalize();
+    }
     const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
+    return commit_native(inputs, generators).normalize();
+}
+
+/**
+ * @brief Generate a pedersen commitment from the fixed-base tables of the generators, without normalizing it.
+ *
+ * @details Does not touch the generator context, so it can be used to compute many commitments concurrently once the
+ * tables have been fetched (see `pedersen_hash_base::hash_batch`).
+ * @param inputs
+ * @param tables fixed-base tables of the generators, as returned by `generator_data::get_fixed_base_tables`
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native(
+    std::span<const Fq> inputs, std::span<const FixedBaseTable<Curve>* const> tables)
+{
+    ASSERT(tables.size() >= inputs.size());
+    Element result = Group::point_at_infinity;
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        result += tables[i]->mul(static_cast<uint256_t>(inputs[i]));
+    }
+    return result;
+}
+
+/**
+ * @brief Generate a pedersen commitment with variable-base multiplications by the generators, without normalizing it.
+ *
+ * @details The fallback for generators without fixed-base tables. Like the table version, it does not touch the
+ * generator context.
+ * @param inputs
+ * @param generators
+ * @return Curve::Element
+ */
+template <typename Curve>
+typename Curve::Element pedersen_commitment_base<Curve>::commit_native(std::span<const Fq> inputs,
+                                                                       std::span<const AffineElement> generators)
+{
+    ASSERT(generators.size() >= inputs.size());
     Element result = Group::point_at_infinity;
 
     for (size_t i = 0; i < inputs.size(); ++i) {
         result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
     }
-    return result.normalize();
+    return result;
 }
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
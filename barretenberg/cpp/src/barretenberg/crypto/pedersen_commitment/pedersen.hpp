@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <span>
 
 namespace bb::crypto {
 
@@ -28,6 +29,8 @@ template <typename Curve> class pedersen_commitment_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static Element commit_native(std::span<const Fq> inputs, std::span<const FixedBaseTable<Curve>* const> tables);
+    static Element commit_native(std::span<const Fq> inputs, std::span<const AffineElement> generators);
 };
 
 using pedersen_commitment = pedersen_commitment_base<curve::Grumpkin>;
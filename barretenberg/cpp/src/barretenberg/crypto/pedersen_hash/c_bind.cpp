@@ -21,14 +21,7 @@ WASM_EXPORT void pedersen_hashes(fr::vec_in_buf inputs_buffer, uint32_t const* h
     read(inputs_buffer, to_hash);
     crypto::GeneratorContext<curve::Grumpkin> ctx;
     ctx.offset = static_cast<size_t>(ntohl(*hash_index));
-    const size_t numHashes = to_hash.size() / 2;
-    std::vector<grumpkin::fq> results;
-    size_t count = 0;
-    while (count < numHashes) {
-        auto r = crypto::pedersen_hash::hash({ to_hash[count * 2], to_hash[count * 2 + 1] }, ctx);
-        results.push_back(r);
-        ++count;
-    }
+    auto results = crypto::pedersen_hash::hash_batch(to_hash, 2, ctx);
     write(output, results);
 }
 
@@ -1,5 +1,7 @@
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 
 namespace bb::crypto {
 
@@ -41,6 +43,53 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
     return elements;
 }
 
+/**
+ * @brief Fixed-base table of the length generator `[h]`, built on first use
+ */
+template <typename Curve> const FixedBaseTable<Curve>& pedersen_hash_base<Curve>::get_length_generator_table()
+{
+    static const FixedBaseTable<Curve> table(length_generator);
+    return table;
+}
+
+namespace {
+/**
+ * @brief Call `func` with the fixed-base tables of `num_generators` generators of `context` if they can be cached (see
+ * `generator_data::get_fixed_base_tables`), or with the generators themselves otherwise
+ */
+template <typename Curve, typename Func>
+auto with_generators(const GeneratorContext<Curve>& context, const size_t num_generators, const Func& func)
+{
+    if (const auto tables =
+            context.generators->get_fixed_base_tables(num_generators, context.offset, context.domain_separator)) {
+        return func(std::span<const FixedBaseTable<Curve>* const>(*tables));
+    }
+    return func(context.generators->get(num_generators, context.offset, context.domain_separator));
+}
+} // namespace
+
+/**
+ * @brief Compute `n.[h] + Commit(x)` from the fixed-base tables of the generators, without normalizing it
+ */
+template <typename Curve>
+typename Curve::Element pedersen_hash_base<Curve>::hash_with_generators(
+    std::span<const Fq> inputs, std::span<const FixedBaseTable<Curve>* const> tables)
+{
+    Element result = get_length_generator_table().mul(inputs.size());
+    return result + pedersen_commitment_base<Curve>::commit_native(inputs, tables);
+}
+
+/**
+ * @brief Compute `n.[h] + Commit(x)` from the generators themselves, without normalizing it
+ */
+template <typename Curve>
+typename Curve::Element pedersen_hash_base<Curve>::hash_with_generators(std::span<const Fq> inputs,
+                                                                        std::span<const AffineElement> generators)
+{
+    Element result = get_length_generator_table().mul(inputs.size());
+    return result + pedersen_commitment_base<Curve>::commit_native(inputs, generators);
+}
+
 /**
  * @brief Given a vector of fields, generate a pedersen hash using generators from `context`.
  *
@@ -56,8 +105,87 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    return with_generators(context, inputs.size(), [&](const auto& generators) {
+        return hash_with_generators(inputs, generators).normalize().x;
+    });
+}
+
+/**
+ * @brief Hashes get_input(0), ..., get_input(num_hashes - 1), see the public `hash_batch` overloads
+ */
+template <typename Curve>
+template <typename GetInput>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(const size_t num_hashes,
+                                                                             const size_t max_num_inputs,
+                                                                             const GetInput& get_input,
+                                                                             const GeneratorContext& context)
+{
+    std::vector<Element> results(num_hashes);
+    with_generators(context, max_num_inputs, [&](const auto& generators) {
+        parallel_for_heuristic(
+            num_hashes,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                for (size_t i = start; i < end; ++i) {
+                    results[i] = hash_with_generators(get_input(i), generators);
+                }
+            },
+            thread_heuristics::ALWAYS_MULTITHREAD);
+        return true;
+    });
+    Element::batch_normalize(results.data(), results.size());
+
+    std::vector<Fq> hashes;
+    hashes.reserve(results.size());
+    for (auto& result : results) {
+        hashes.emplace_back(result.is_point_at_infinity() ? result.normalize().x : result.x);
+    }
+    return hashes;
+}
+
+/**
+ * @brief Hash many vectors of fields with the same generator context
+ *
+ * @details Equivalent to calling `hash` on each vector. The generators are fetched once, the hashes are computed in
+ * parallel and the results share a single field inversion when converted to affine form.
+ *
+ * @param inputs the vectors to hash (they may differ in length)
+ * @param context
+ * @return std::vector<Fq> one hash per input vector, in order
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(const std::vector<std::vector<Fq>>& inputs,
+                                                                             const GeneratorContext context)
+{
+    size_t max_num_inputs = 0;
+    for (const auto& input : inputs) {
+        max_num_inputs = std::max(max_num_inputs, input.size());
+    }
+    return hash_batch(
+        inputs.size(), max_num_inputs, [&](size_t i) { return std::span<const Fq>(inputs[i]); }, context);
+}
+
+/**
+ * @brief Hash consecutive `hash_size`-element slices of a flat buffer, e.g. the sibling pairs of a Merkle tree layer
+ *
+ * @details Equivalent to calling `hash` on each slice, see the other `hash_batch` overload. Any trailing elements that
+ * do not fill a whole slice are ignored.
+ *
+ * @param inputs
+ * @param hash_size the number of elements hashed together, must be nonzero
+ * @param context
+ * @return std::vector<Fq> inputs.size() / hash_size hashes, in order
+ */
+template <typename Curve>
+std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::hash_batch(std::span<const Fq> inputs,
+                                                                             const size_t hash_size,
+                                                                             const GeneratorContext context)
+{
+    ASSERT(hash_size > 0);
+    return hash_batch(
+        inputs.size() / hash_size,
+        hash_size,
+        [&](size_t i) { return inputs.subspan(i * hash_size, hash_size); },
+        context);
 }
 
 /**
@@ -72,11 +200,14 @@ typename Curve::BaseField pedersen_hash_base<Curve>::hash_buffer(const std::vect
     if (converted.size() < 2) {
         return hash(converted, context);
     }
-    auto result = hash({ converted[0], converted[1] }, context);
-    for (size_t i = 2; i < converted.size(); ++i) {
-        result = hash({ result, converted[i] }, context);
-    }
-    return result;
+    // Every link of the chain hashes two elements with the same generators, so fetch them once
+    return with_generators(context, 2, [&](const auto& generators) {
+        auto result = hash_with_generators(std::array{ converted[0], converted[1] }, generators).normalize().x;
+        for (size_t i = 2; i < converted.size(); ++i) {
+            result = hash_with_generators(std::array{ result, converted[i] }, generators).normalize().x;
+        }
+        return result;
+    });
 }
 
 template class pedersen_hash_base<curve::Grumpkin>;
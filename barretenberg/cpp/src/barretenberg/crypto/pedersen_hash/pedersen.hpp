@@ -2,6 +2,7 @@
 
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <span>
 namespace bb::crypto {
 /**
  * @brief Performs pedersen hashes!
@@ -30,10 +31,21 @@ template <typename Curve> class pedersen_hash_base {
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
     inline static constexpr AffineElement length_generator = Group::derive_generators("pedersen_hash_length", 1)[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(const std::vector<std::vector<Fq>>& inputs, GeneratorContext context = {});
+    static std::vector<Fq> hash_batch(std::span<const Fq> inputs, size_t hash_size, GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
+    static const FixedBaseTable<Curve>& get_length_generator_table();
+    static Element hash_with_generators(std::span<const Fq> inputs,
+                                        std::span<const FixedBaseTable<Curve>* const> tables);
+    static Element hash_with_generators(std::span<const Fq> inputs, std::span<const AffineElement> generators);
+    template <typename GetInput>
+    static std::vector<Fq> hash_batch(size_t num_hashes,
+                                      size_t max_num_inputs,
+                                      const GetInput& get_input,
+                                      const GeneratorContext& context);
 };
 
 using pedersen_hash = pedersen_hash_base<curve::Grumpkin>;
@@ -32,4 +32,74 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
-} // namespace bb::crypto
\ No newline at end of file
+TEST(Pedersen, HashBatch)
+{
+    std::vector<std::vector<pedersen_hash::Fq>> inputs;
+    for (size_t num_inputs = 1; num_inputs < 12; ++num_inputs) {
+        std::vector<pedersen_hash::Fq> input(num_inputs);
+        for (auto& element : input) {
+            element = pedersen_hash::Fq::random_element();
+        }
+        inputs.emplace_back(input);
+    }
+
+    for (const size_t hash_index : { 0UL, 5UL }) {
+        auto results = pedersen_hash::hash_batch(inputs, hash_index);
+        ASSERT_EQ(results.size(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            EXPECT_EQ(results[i], pedersen_hash::hash(inputs[i], hash_index));
+        }
+    }
+}
+
+TEST(Pedersen, HashBatchFlat)
+{
+    std::vector<pedersen_hash::Fq> inputs(2 * 9 + 1);
+    for (auto& element : inputs) {
+        element = pedersen_hash::Fq::random_element();
+    }
+
+    auto results = pedersen_hash::hash_batch(inputs, 2, 3);
+    ASSERT_EQ(results.size(), 9);
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], pedersen_hash::hash({ inputs[2 * i], inputs[2 * i + 1] }, 3));
+    }
+}
+
+/**
+ * @brief Generators beyond the cached fixed-base tables fall back to variable-base multiplications
+ */
+TEST(Pedersen, HashWithoutFixedBaseTables)
+{
+    using Element = pedersen_hash::Element;
+    const size_t hash_index = generator_data<curve::Grumpkin>::MAX_FIXED_BASE_TABLE_GENERATORS;
+    std::vector<pedersen_hash::Fq> inputs = { pedersen_hash::Fq::random_element(), pedersen_hash::Fq::random_element() };
+
+    const auto generators = GeneratorContext<curve::Grumpkin>().generators->get(2, hash_index);
+    Element expected = Element(pedersen_hash::length_generator) * pedersen_hash::Fr(2);
+    expected += Element(generators[0]) * static_cast<uint256_t>(inputs[0]);
+    expected += Element(generators[1]) * static_cast<uint256_t>(inputs[1]);
+
+    EXPECT_EQ(pedersen_hash::hash(inputs, hash_index), expected.normalize().x);
+    EXPECT_EQ(pedersen_hash::hash_batch(inputs, 2, hash_index)[0], expected.normalize().x);
+}
+
+TEST(Pedersen, HashBuffer)
+{
+    std::vector<uint8_t> input(100);
+    for (size_t i = 0; i < input.size(); ++i) {
+        input[i] = static_cast<uint8_t>(i);
+    }
+    // hash_buffer chains two-to-one hashes over the 31-byte chunks of the input
+    std::vector<pedersen_hash::Fq> chunks(4);
+    for (size_t i = 0; i < input.size(); ++i) {
+        chunks[i / 31] = chunks[i / 31] * 256 + input[i];
+    }
+    auto expected = pedersen_hash::hash({ chunks[0], chunks[1] });
+    expected = pedersen_hash::hash({ expected, chunks[2] });
+    expected = pedersen_hash::hash({ expected, chunks[3] });
+
+    EXPECT_EQ(pedersen_hash::hash_buffer(input), expected);
+}
+
+} // namespace bb::crypto
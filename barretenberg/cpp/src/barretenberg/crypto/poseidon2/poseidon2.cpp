@@ -1,4 +1,5 @@
 #include "poseidon2.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 /**
@@ -10,6 +11,46 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_fixed_length(input);
 }
 
+/**
+ * @brief Hashes two field elements without allocating
+ */
+template <typename Params>
+typename Poseidon2<Params>::FF Poseidon2<Params>::hash_pair(const FF& lhs, const FF& rhs)
+{
+    const std::array<FF, 2> input{ lhs, rhs };
+    return Sponge::hash_fixed_length(input);
+}
+
+/**
+ * @brief Hashes consecutive pairs of inputs into outputs
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_pairs(std::span<const FF> inputs, std::span<FF> outputs)
+{
+    ASSERT(inputs.size() == outputs.size() * 2);
+    using Permutation = Poseidon2Permutation<Params>;
+    constexpr size_t NUM_LANES = HASH_PAIRS_NUM_LANES;
+
+    // Sponge state after absorbing a pair, as in Sponge::hash_fixed_length: the rate holds the inputs (padded with
+    // zeros) and the capacity element is the IV encoding the input and output lengths.
+    const FF iv = static_cast<uint256_t>(2) << 64;
+    std::array<typename Permutation::State, NUM_LANES> states;
+
+    const size_t num_batched = outputs.size() - (outputs.size() % NUM_LANES);
+    for (size_t i = 0; i < num_batched; i += NUM_LANES) {
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            states[lane] = { inputs[2 * (i + lane)], inputs[2 * (i + lane) + 1], FF(0), iv };
+        }
+        Permutation::permutation_lanes(states);
+        for (size_t lane = 0; lane < NUM_LANES; ++lane) {
+            outputs[i + lane] = states[lane][0];
+        }
+    }
+    for (size_t i = num_batched; i < outputs.size(); ++i) {
+        outputs[i] = hash_pair(inputs[2 * i], inputs[2 * i + 1]);
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -4,6 +4,9 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -17,6 +20,20 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes two field elements, equal to hash({ lhs, rhs }) but without allocating
+     */
+    static FF hash_pair(const FF& lhs, const FF& rhs);
+    /**
+     * @brief Hashes consecutive pairs of inputs, outputs[i] = hash_pair(inputs[2i], inputs[2i + 1])
+     * @details Used to hash a level of a merkle tree in one call. outputs must hold inputs.size() / 2 elements. Pairs
+     * are permuted HASH_PAIRS_NUM_LANES at a time, without allocating.
+     */
+    static void hash_pairs(std::span<const FF> inputs, std::span<FF> outputs);
+    /**
+     * @brief Number of pairs hashed per call to the multi-lane permutation in hash_pairs()
+     */
+    static constexpr size_t HASH_PAIRS_NUM_LANES = 4;
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,20 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashPairsMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t NUM_PAIRS = 9;
+    std::vector<fr> inputs(NUM_PAIRS * 2);
+    for (auto& input : inputs) {
+        input = fr::random_element(&engine);
+    }
+    std::vector<fr> outputs(NUM_PAIRS);
+    Poseidon2::hash_pairs(inputs, outputs);
+
+    for (size_t i = 0; i < NUM_PAIRS; ++i) {
+        EXPECT_EQ(outputs[i], Poseidon2::hash({ inputs[2 * i], inputs[2 * i + 1] }));
+        EXPECT_EQ(outputs[i], Poseidon2::hash_pair(inputs[2 * i], inputs[2 * i + 1]));
+    }
+}
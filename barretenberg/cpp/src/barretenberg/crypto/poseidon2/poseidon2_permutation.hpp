@@ -160,5 +160,47 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Apply the permutation to NUM_LANES independent states, in place.
+     * @details Equivalent to calling permutation() on each state. Each step of the permutation is applied to every lane
+     * before moving on to the next step: within a single state the partial rounds form a long chain of dependent
+     * multiplications, whereas the lanes are independent, so their Montgomery multiplications can be overlapped.
+     * @param states
+     */
+    template <size_t NUM_LANES> static constexpr void permutation_lanes(std::array<State, NUM_LANES>& states)
+    {
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& state : states) {
+                state[0] += round_constants[i][0];
+                apply_single_sbox(state[0]);
+            }
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            for (auto& state : states) {
+                add_round_constants(state, round_constants[i]);
+                apply_sbox(state);
+                matrix_multiplication_external(state);
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -59,3 +59,23 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, LanesMatchSinglePermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    constexpr size_t NUM_LANES = 5;
+
+    std::array<Permutation::State, NUM_LANES> states;
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    auto expected = states;
+    for (auto& state : expected) {
+        state = Permutation::permutation(state);
+    }
+
+    Permutation::permutation_lanes(states);
+    EXPECT_EQ(states, expected);
+}
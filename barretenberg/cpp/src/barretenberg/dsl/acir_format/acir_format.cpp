@@ -486,6 +486,7 @@ MegaCircuitBuilder create_kernel_circuit(AcirFormat& constraint_system,
                                                       /*collect_gates_per_opcode=*/false);
 
     // We expect the length of the internal verification queue to match the number of ivc recursion constraints
+    ivc.finish_pending_fold();
     if (constraint_system.ivc_recursion_constraints.size() != ivc.verification_queue.size()) {
         info("WARNING: Mismatch in number of recursive verifications during kernel creation!");
         ASSERT(false);
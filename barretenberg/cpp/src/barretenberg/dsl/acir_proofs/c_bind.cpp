@@ -20,7 +20,9 @@ WASM_EXPORT void acir_get_circuit_sizes(
 {
     auto constraint_system =
         acir_format::circuit_buf_to_acir_format(from_buffer<std::vector<uint8_t>>(acir_vec), *honk_recursion);
-    auto builder = acir_format::create_circuit(constraint_system, recursive, 1 << 19, {}, *honk_recursion);
+    // No size hint: the builder's variable tables are sized from the ACIR witness count, and the gate count is what
+    // we are here to find out
+    auto builder = acir_format::create_circuit(constraint_system, recursive, 0, {}, *honk_recursion);
     builder.finalize_circuit(/*ensure_nonzero=*/true);
     *total = htonl((uint32_t)builder.get_finalized_total_circuit_size());
     *subgroup = htonl((uint32_t)builder.get_circuit_subgroup_size(builder.get_finalized_total_circuit_size()));
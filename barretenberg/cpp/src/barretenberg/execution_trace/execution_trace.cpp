@@ -1,9 +1,13 @@
 #include "execution_trace.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/plonk_flavors.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+
+#include <algorithm>
 namespace bb {
 
 template <class Flavor> void ExecutionTrace_<Flavor>::populate_public_inputs_block(Builder& builder)
@@ -26,14 +30,17 @@ template <class Flavor> void ExecutionTrace_<Flavor>::populate_public_inputs_blo
 }
 
 template <class Flavor>
-void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+void ExecutionTrace_<Flavor>::populate(Builder& builder,
+                                      typename Flavor::ProvingKey& proving_key,
+                                      bool is_structured,
+                                      bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("trace populate");
 
     // Share wire polynomials, selector polynomials between proving key and builder and copy cycles from raw circuit
     // data
-    auto trace_data = construct_trace_data(builder, proving_key, is_structured);
+    auto trace_data = construct_trace_data(builder, proving_key, is_structured, populate_precomputed);
 
     if constexpr (IsHonkFlavor<Flavor>) {
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
@@ -49,11 +56,11 @@ void ExecutionTrace_<Flavor>::populate(Builder& builder, typename Flavor::Provin
 
         PROFILE_THIS_NAME("add_ecc_op_wires_to_proving_key");
 
-        add_ecc_op_wires_to_proving_key(builder, proving_key);
+        add_ecc_op_wires_to_proving_key(builder, proving_key, populate_precomputed);
     }
 
     // Compute the permutation argument polynomials (sigma/id) and add them to proving key
-    {
+    if (populate_precomputed) {
 
         PROFILE_THIS_NAME("compute_permutation_argument_polynomials");
 
@@ -80,7 +87,7 @@ void ExecutionTrace_<Flavor>::add_memory_records_to_proving_key(TraceData& trace
 
 template <class Flavor>
 typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_trace_data(
-    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured)
+    Builder& builder, typename Flavor::ProvingKey& proving_key, bool is_structured, bool populate_precomputed)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
@@ -92,8 +99,19 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
 
     TraceData trace_data{ builder, proving_key };
 
+    // The wire addresses of the trace and the real variable each of them holds, from which the copy cycles are built
+    std::vector<VariableAddress> addresses;
+    if (populate_precomputed) {
+        size_t num_addresses = 0;
+        for (auto& block : builder.blocks.get()) {
+            num_addresses += block.size() * NUM_WIRES;
+        }
+        addresses.resize(num_addresses);
+    }
+    size_t block_address_start = 0; // Start of the current block's wire addresses in the addresses array
+
     uint32_t offset = Flavor::has_zero_row ? 1 : 0; // Offset at which to place each block in the trace polynomials
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    // For each block in the trace, populate wire polys and selector polys and collect the wire addresses
 
     for (auto& block : builder.blocks.get()) {
         auto block_size = static_cast<uint32_t>(block.size());
@@ -103,32 +121,39 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
             proving_key.active_block_ranges.emplace_back(offset, offset + block.size());
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
+        // Update wire polynomials and collect the addresses of each variable
         {
 
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    trace_data.copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
-            }
+            PROFILE_THIS_NAME("populating wires and collecting copy_cycles");
+
+            parallel_for_heuristic(
+                block_size,
+                [&](size_t block_row_idx) {
+                    for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                        uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
+                        size_t trace_row_idx = block_row_idx + offset;
+                        // Insert the real witness values from this block into the wire polys at the correct offset
+                        trace_data.wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
+                        if (populate_precomputed) {
+                            addresses[block_address_start + block_row_idx * NUM_WIRES + wire_idx] = {
+                                builder.real_variable_index[var_idx],
+                                static_cast<uint32_t>(trace_row_idx * NUM_WIRES + wire_idx)
+                            };
+                        }
+                    }
+                },
+                thread_heuristics::FF_COPY_COST * NUM_WIRES);
         }
 
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
-            auto& selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
+        if (populate_precomputed) {
+            for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
+                auto& selector = block.selectors[selector_idx];
+                for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
+                    size_t trace_row_idx = row_idx + offset;
+                    trace_data.selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
+                }
             }
         }
 
@@ -144,13 +169,103 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
         // If the trace is structured, we populate the data from the next block at a fixed block size offset
         // otherwise, the next block starts immediately following the previous one
         offset += block.get_fixed_size(is_structured);
+        block_address_start += block.size() * NUM_WIRES;
+    }
+
+    if (populate_precomputed) {
+
+        PROFILE_THIS_NAME("populating copy_cycles");
+
+        construct_copy_cycles(trace_data, builder.variables.size(), addresses);
     }
     return trace_data;
 }
 
+template <class Flavor>
+void ExecutionTrace_<Flavor>::construct_copy_cycles(TraceData& trace_data,
+                                                    const size_t num_variables,
+                                                    const std::vector<VariableAddress>& addresses)
+{
+    // Variables are grouped into buckets of 2^bucket_shift consecutive indices, at most 2^MAX_NUM_BUCKETS_LOG buckets
+    constexpr size_t MAX_NUM_BUCKETS_LOG = 10;
+    // Each chunk keeps a histogram of the buckets, so chunks should be much larger than that
+    constexpr size_t MIN_ADDRESSES_PER_CHUNK = 1UL << 15;
+
+    const size_t num_addresses = addresses.size();
+    auto& copy_cycles = trace_data.copy_cycles;
+    copy_cycles.offsets.resize(num_variables + 1);
+    copy_cycles.nodes.resize(num_addresses);
+    copy_cycles.offsets[num_variables] = static_cast<uint32_t>(num_addresses);
+    if (num_variables == 0) {
+        return;
+    }
+
+    const size_t variable_bits = numeric::get_msb(num_variables - 1) + 1;
+    const size_t bucket_shift = variable_bits > MAX_NUM_BUCKETS_LOG ? variable_bits - MAX_NUM_BUCKETS_LOG : 0;
+    const size_t num_buckets = ((num_variables - 1) >> bucket_shift) + 1;
+
+    // Scatter the addresses into their buckets. Every chunk counts its own addresses per bucket and then writes them,
+    // in order, to the positions following those of the previous chunks, so each bucket stays in trace order.
+    const size_t num_chunks = calculate_num_threads(num_addresses, MIN_ADDRESSES_PER_CHUNK);
+    const size_t chunk_size = (num_addresses + num_chunks - 1) / num_chunks;
+    std::vector<uint32_t> chunk_cursors(num_chunks * num_buckets);
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        uint32_t* histogram = &chunk_cursors[chunk_idx * num_buckets];
+        const size_t end = std::min(num_addresses, (chunk_idx + 1) * chunk_size);
+        for (size_t i = chunk_idx * chunk_size; i < end; ++i) {
+            histogram[addresses[i].real_variable_index >> bucket_shift]++;
+        }
+    });
+    std::vector<uint32_t> bucket_starts(num_buckets + 1);
+    uint32_t position = 0;
+    for (size_t bucket_idx = 0; bucket_idx < num_buckets; ++bucket_idx) {
+        bucket_starts[bucket_idx] = position;
+        for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+            const uint32_t count = chunk_cursors[chunk_idx * num_buckets + bucket_idx];
+            chunk_cursors[chunk_idx * num_buckets + bucket_idx] = position;
+            position += count;
+        }
+    }
+    bucket_starts[num_buckets] = position;
+    std::vector<VariableAddress> bucketed(num_addresses);
+    parallel_for(num_chunks, [&](size_t chunk_idx) {
+        uint32_t* cursors = &chunk_cursors[chunk_idx * num_buckets];
+        const size_t end = std::min(num_addresses, (chunk_idx + 1) * chunk_size);
+        for (size_t i = chunk_idx * chunk_size; i < end; ++i) {
+            bucketed[cursors[addresses[i].real_variable_index >> bucket_shift]++] = addresses[i];
+        }
+    });
+
+    // Lay out the cycles of each bucket with a counting sort, which also keeps every cycle in trace order (by row, then
+    // by wire). A bucket is small enough for its addresses and counters to stay in cache.
+    parallel_for(num_buckets, [&](size_t bucket_idx) {
+        const size_t first_variable = bucket_idx << bucket_shift;
+        const size_t bucket_num_variables = std::min(num_variables - first_variable, 1UL << bucket_shift);
+        std::span<const VariableAddress> bucket{ bucketed.data() + bucket_starts[bucket_idx],
+                                                 bucket_starts[bucket_idx + 1] - bucket_starts[bucket_idx] };
+        std::vector<uint32_t> cursors(bucket_num_variables);
+        for (const auto& entry : bucket) {
+            cursors[entry.real_variable_index - first_variable]++;
+        }
+        uint32_t cycle_start = bucket_starts[bucket_idx];
+        for (size_t i = 0; i < bucket_num_variables; ++i) {
+            const uint32_t cycle_size = cursors[i];
+            copy_cycles.offsets[first_variable + i] = cycle_start;
+            cursors[i] = cycle_start;
+            cycle_start += cycle_size;
+        }
+        for (const auto& entry : bucket) {
+            copy_cycles.nodes[cursors[entry.real_variable_index - first_variable]++] = {
+                static_cast<uint32_t>(entry.address % NUM_WIRES), static_cast<uint32_t>(entry.address / NUM_WIRES)
+            };
+        }
+    });
+}
+
 template <class Flavor>
 void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
-                                                              typename Flavor::ProvingKey& proving_key)
+                                                              typename Flavor::ProvingKey& proving_key,
+                                                              bool populate_precomputed)
     requires IsGoblinFlavor<Flavor>
 {
     auto& ecc_op_selector = proving_key.polynomials.lagrange_ecc_op;
@@ -163,7 +278,9 @@ void ExecutionTrace_<Flavor>::add_ecc_op_wires_to_proving_key(Builder& builder,
         for (size_t i = 0; i < num_ecc_ops; ++i) {
             size_t idx = i + op_wire_offset;
             ecc_op_wire.at(idx) = wire[idx];
-            ecc_op_selector.at(idx) = 1; // construct selector as the indicator on the ecc op block
+            if (populate_precomputed) {
+                ecc_op_selector.at(idx) = 1; // construct selector as the indicator on the ecc op block
+            }
         }
     }
 }
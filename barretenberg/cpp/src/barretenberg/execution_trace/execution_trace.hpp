@@ -3,6 +3,7 @@
 #include "barretenberg/plonk_honk_shared/composer/permutation_lib.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+
 namespace bb {
 
 template <class Flavor> class ExecutionTrace_ {
@@ -18,11 +19,19 @@ template <class Flavor> class ExecutionTrace_ {
 
     static constexpr size_t NUM_SELECTORS = Builder::Arithmetization::NUM_SELECTORS;
 
+    /**
+     * @brief A wire address holding a real variable, collected in trace order while populating the wires
+     */
+    struct VariableAddress {
+        uint32_t real_variable_index;
+        uint32_t address; // gate_index * NUM_WIRES + wire_index, i.e. increasing in trace order
+    };
+
     struct TraceData {
         std::array<Polynomial, NUM_WIRES> wires;
         std::array<Polynomial, NUM_SELECTORS> selectors;
-        // A vector of sets (vectors) of addresses into the wire polynomials whose values are copy constrained
-        std::vector<CyclicPermutation> copy_cycles;
+        // The sets of addresses into the wire polynomials whose values are copy constrained, one per variable
+        CopyCycles copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
 
@@ -57,11 +66,6 @@ template <class Flavor> class ExecutionTrace_ {
                     }
                 }
             }
-            {
-                PROFILE_THIS_NAME("copy cycle initialization");
-
-                copy_cycles.resize(builder.variables.size());
-            }
         }
     };
 
@@ -75,8 +79,13 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed if false, only the witness half of the trace is populated: the selectors, the copy
+     * cycles and the sigma/id polynomials are skipped since the proving key already holds them (Honk only)
      */
-    static void populate(Builder& builder, ProvingKey&, bool is_structured = false);
+    static void populate(Builder& builder,
+                         ProvingKey&,
+                         bool is_structured = false,
+                         bool populate_precomputed = true);
 
     /**
      * @brief Populate the public inputs block
@@ -110,11 +119,29 @@ template <class Flavor> class ExecutionTrace_ {
      * @param builder
      * @param dyadic_circuit_size
      * @param is_structured whether or not the trace is to be structured with a fixed block size
+     * @param populate_precomputed whether to populate the selectors and construct the copy cycles
      * @return TraceData
      */
     static TraceData construct_trace_data(Builder& builder,
                                           typename Flavor::ProvingKey& proving_key,
-                                          bool is_structured = false);
+                                          bool is_structured = false,
+                                          bool populate_precomputed = true);
+
+    /**
+     * @brief Lay out the copy cycles of the trace from the wire addresses of every real variable
+     * @details The addresses, collected in trace order, are grouped by variable with a stable two level counting sort:
+     * they are first scattered into buckets of consecutive variables using per-chunk histograms, so that each chunk
+     * writes to its own precomputed positions, and each bucket is then counting sorted on its own. No counter is shared
+     * between threads and every cycle comes out in trace order (by row, then by wire) without sorting it, so the
+     * resulting permutation, and hence the verification key, does not depend on the thread schedule.
+     *
+     * @param trace_data
+     * @param num_variables the number of variables of the circuit, i.e. of copy cycles
+     * @param addresses the wire addresses of the trace in trace order
+     */
+    static void construct_copy_cycles(TraceData& trace_data,
+                                      size_t num_variables,
+                                      const std::vector<VariableAddress>& addresses);
 
     /**
      * @brief Construct and add the goblin ecc op wires to the proving key
@@ -123,8 +150,11 @@ template <class Flavor> class ExecutionTrace_ {
      *
      * @param builder
      * @param proving_key
+     * @param populate_precomputed whether to also construct the ecc op selector
      */
-    static void add_ecc_op_wires_to_proving_key(Builder& builder, typename Flavor::ProvingKey& proving_key)
+    static void add_ecc_op_wires_to_proving_key(Builder& builder,
+                                                typename Flavor::ProvingKey& proving_key,
+                                                bool populate_precomputed = true)
         requires IsGoblinFlavor<Flavor>;
 };
 
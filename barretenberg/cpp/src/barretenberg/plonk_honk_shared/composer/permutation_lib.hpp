@@ -9,15 +9,18 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
+#include "barretenberg/stdlib_circuit_builders/circuit_builder_base.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -66,23 +69,42 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
         PROFILE_THIS_NAME("PermutationMapping constructor");
 
         for (uint8_t col_idx = 0; col_idx < NUM_WIRES; ++col_idx) {
-            sigmas[col_idx].reserve(circuit_size);
+            sigmas[col_idx].resize(circuit_size);
             if constexpr (generalized) {
-                ids[col_idx].reserve(circuit_size);
+                ids[col_idx].resize(circuit_size);
             }
             // Initialize every element to point to itself
-            for (uint32_t row_idx = 0; row_idx < circuit_size; ++row_idx) {
-                permutation_subgroup_element self{ row_idx, col_idx };
-                sigmas[col_idx].emplace_back(self);
-                if constexpr (generalized) {
-                    ids[col_idx].emplace_back(self);
-                }
-            }
+            parallel_for_heuristic(
+                circuit_size,
+                [&](size_t row_idx) {
+                    permutation_subgroup_element self{ static_cast<uint32_t>(row_idx), col_idx };
+                    sigmas[col_idx][row_idx] = self;
+                    if constexpr (generalized) {
+                        ids[col_idx][row_idx] = self;
+                    }
+                },
+                thread_heuristics::FF_COPY_COST);
         }
     }
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, stored in compressed sparse row form
+ * @details The cycle of real variable i consists of nodes[offsets[i], offsets[i + 1]), i.e. the addresses in the wire
+ * polynomials at which its value appears, in the order in which they appear in the trace. Variables which are not real
+ * (i.e. were copy-constrained to another one) have empty cycles.
+ */
+struct CopyCycles {
+    std::vector<uint32_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    std::span<const cycle_node> operator[](size_t cycle_idx) const
+    {
+        return std::span{ nodes }.subspan(offsets[cycle_idx], offsets[cycle_idx + 1] - offsets[cycle_idx]);
+    }
+};
 
 namespace {
 /**
@@ -101,7 +123,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -109,45 +131,51 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
 
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
+    std::span<const uint32_t> tau = circuit_constructor.tau;
+
+    // Go through each cycle. Each wire address belongs to exactly one cycle, so cycles can be processed in parallel
+    const size_t num_cycles = wire_copy_cycles.size();
+    const size_t average_cycle_size = num_cycles == 0 ? 0 : wire_copy_cycles.nodes.size() / num_cycles;
+    parallel_for_heuristic(
+        num_cycles,
+        [&](size_t cycle_index) {
+            const auto copy_cycle = wire_copy_cycles[cycle_index];
+            for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                // Get the indices of the current node and next node in the cycle
+                const cycle_node& current_cycle_node = copy_cycle[node_idx];
+                // If current node is the last one in the cycle, then the next one is the first one
+                size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_cycle_node = copy_cycle[next_cycle_node_index];
+                const auto current_row = current_cycle_node.gate_index;
+                const auto next_row = next_cycle_node.gate_index;
+
+                const auto current_column = current_cycle_node.wire_index;
+                const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                // Point current node to the next node
+                mapping.sigmas[current_column][current_row] = {
+                    .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                };
 
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (const auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            const cycle_node& current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
-
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                if constexpr (generalized) {
+                    bool first_node = (node_idx == 0);
+                    bool last_node = (next_cycle_node_index == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column][current_row].is_tag = true;
+                        mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column][current_row].is_tag = true;
+
+                        // Every tag in use must have been mapped by create_tag()
+                        ASSERT(real_variable_tags[cycle_index] < tau.size() &&
+                               tau[real_variable_tags[cycle_index]] != UNSET_TAU);
+                        mapping.sigmas[current_column][current_row].row_index = tau[real_variable_tags[cycle_index]];
+                    }
                 }
             }
-        }
-        cycle_index++;
-    }
+        },
+        thread_heuristics::FF_COPY_COST * (average_cycle_size + 1));
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -372,7 +400,7 @@ inline std::tuple<LegacyPolynomial<FF>, LegacyPolynomial<FF>> compute_first_and_
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraPlonkFlavor<Flavor> || IsUltraFlavor<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
@@ -6,8 +6,10 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/plonk_honk_shared/types/circuit_type.hpp"
+#include <array>
 #include <memory.h>
 #include <memory>
+#include <mutex>
 
 namespace bb {
 
@@ -47,6 +49,48 @@ void compute_lookup_table_single(const Fr& input_root,
         }
     }
 }
+
+/**
+ * @brief Process-wide cache of root tables, so that domains of the same size share one table across proofs
+ * @details Tables up to 2^MAX_RETAINED_LOG2_SIZE are kept alive by the cache itself; larger ones are only shared while
+ * some domain still holds them.
+ */
+template <typename Fr> class RootTableCache {
+  public:
+    static std::shared_ptr<Fr[]> get(const Fr& root, const size_t size)
+    {
+        static RootTableCache cache;
+        const auto log2_size = static_cast<size_t>(numeric::get_msb(size));
+        std::unique_lock lock(cache.mutex);
+        Entry& entry = cache.entries[log2_size];
+        std::shared_ptr<Fr[]> roots = entry.roots.lock();
+        if (roots == nullptr || entry.root != root) {
+            roots = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * size * 2));
+            std::vector<Fr*> round_roots;
+            std::vector<Fr*> inverse_round_roots;
+            compute_lookup_table_single(root, size, roots.get(), round_roots);
+            compute_lookup_table_single(root.invert(), size, &roots.get()[size], inverse_round_roots);
+            entry.root = root;
+            entry.roots = roots;
+            entry.retained = log2_size <= MAX_RETAINED_LOG2_SIZE ? roots : nullptr;
+        }
+        return roots;
+    }
+
+  private:
+#ifdef __wasm__
+    static constexpr size_t MAX_RETAINED_LOG2_SIZE = 0;
+#else
+    static constexpr size_t MAX_RETAINED_LOG2_SIZE = 20;
+#endif
+    struct Entry {
+        Fr root = Fr::zero();
+        std::weak_ptr<Fr[]> roots;
+        std::shared_ptr<Fr[]> retained;
+    };
+    std::mutex mutex;
+    std::array<Entry, 64> entries;
+};
 } // namespace
 
 template <typename Fr>
@@ -100,9 +144,8 @@ EvaluationDomain<Fr>::EvaluationDomain(const EvaluationDomain& other)
     ASSERT((1UL << log2_thread_size) == thread_size);
     ASSERT((1UL << log2_num_threads) == num_threads);
     if (other.roots != nullptr) {
-        const size_t mem_size = sizeof(Fr) * size * 2;
-        roots = std::static_pointer_cast<Fr[]>(get_mem_slab(mem_size));
-        memcpy(static_cast<void*>(roots.get()), static_cast<void*>(other.roots.get()), mem_size);
+        // The root table is never written after it is computed, so copies share it
+        roots = other.roots;
         round_roots.resize(log2_size - 1);
         inverse_round_roots.resize(log2_size - 1);
         round_roots[0] = &roots[0];
@@ -170,10 +213,13 @@ template <typename Fr> EvaluationDomain<Fr>::~EvaluationDomain() {}
 template <typename Fr> void EvaluationDomain<Fr>::compute_lookup_table()
 {
     ASSERT(roots == nullptr);
-    // roots = (Fr*)(aligned_alloc(32, sizeof(Fr) * size * 2));
-    roots = std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * size * 2));
-    compute_lookup_table_single(root, size, roots.get(), round_roots);
-    compute_lookup_table_single(root_inverse, size, &roots.get()[size], inverse_round_roots);
+    roots = RootTableCache<Fr>::get(root, size);
+    round_roots.emplace_back(&roots[0]);
+    inverse_round_roots.emplace_back(&roots.get()[size]);
+    for (size_t i = 1; i < log2_size - 1; ++i) {
+        round_roots.emplace_back(round_roots.back() + (1UL << i));
+        inverse_round_roots.emplace_back(inverse_round_roots.back() + (1UL << i));
+    }
 }
 
 // explicitly instantiate both EvaluationDomain
@@ -266,6 +266,53 @@ void fft_bench_serial(State& state) noexcept
 }
 BENCHMARK(fft_bench_serial)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
 
+// The unblocked radix-2 transform that fft() used before the blocked NTT, for comparison with fft_bench_parallel
+void fft_bench_parallel_unblocked(State& state) noexcept
+{
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        bb::polynomial_arithmetic::fft_inner_parallel({ globals.data },
+                                                      evaluation_domains[idx],
+                                                      evaluation_domains[idx].root,
+                                                      evaluation_domains[idx].get_round_roots());
+    }
+}
+BENCHMARK(fft_bench_parallel_unblocked)
+    ->RangeMultiplier(2)
+    ->Range(START * 4, MAX_GATES * 4)
+    ->Unit(benchmark::kMicrosecond);
+
+constexpr size_t FFT_BATCH_SIZE = 4;
+
+std::array<fr*, FFT_BATCH_SIZE> get_fft_batch(const size_t size)
+{
+    std::array<fr*, FFT_BATCH_SIZE> polynomials;
+    for (size_t i = 0; i < FFT_BATCH_SIZE; ++i) {
+        polynomials[i] = &globals.data[i * size];
+    }
+    return polynomials;
+}
+
+void batch_fft_bench(State& state) noexcept
+{
+    const auto polynomials = get_fft_batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        bb::polynomial_arithmetic::batch_fft<fr>(polynomials, evaluation_domains[idx]);
+    }
+}
+BENCHMARK(batch_fft_bench)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
+void batch_coset_fft_bench(State& state) noexcept
+{
+    const auto polynomials = get_fft_batch(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        size_t idx = (size_t)numeric::get_msb((uint64_t)state.range(0)) - (size_t)numeric::get_msb(START);
+        bb::polynomial_arithmetic::batch_coset_fft<fr>(polynomials, evaluation_domains[idx]);
+    }
+}
+BENCHMARK(batch_coset_fft_bench)->RangeMultiplier(2)->Range(START * 4, MAX_GATES * 4)->Unit(benchmark::kMicrosecond);
+
 void pairing_bench(State& state) noexcept
 {
     uint64_t count = 0;
@@ -101,6 +101,25 @@ template <typename Fr> class Polynomial {
     {
         return Polynomial(/*actual size*/ virtual_size - 1, virtual_size, /*shiftable offset*/ 1);
     }
+
+    /**
+     * @brief Create a polynomial over memory owned elsewhere (e.g. a memory-mapped file), without copying
+     * @details backing_memory holds the coefficients start_index, ..., start_index + size - 1 and is kept alive by the
+     * polynomial and all of its shares.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    static Polynomial from_backing_memory(std::shared_ptr<Fr[]> backing_memory,
+                                          size_t size,
+                                          size_t virtual_size,
+                                          size_t start_index = 0)
+    {
+        ASSERT(start_index + size <= virtual_size);
+        Polynomial result;
+        result.coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+            start_index, start_index + size, virtual_size, std::move(backing_memory)
+        };
+        return result;
+    }
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -391,6 +391,172 @@ void fft_inner_parallel(
     }
 }
 
+/**
+ * @brief Cache-blocked radix-2/radix-4 NTT over one or more polynomials of the same domain
+ * @details The textbook iterative FFT makes one pass over the whole array per round, which for large domains means
+ * log2(n) round trips through main memory. Here the rounds are split in two phases:
+ *  1. After the bit-reversal permutation, the first BLOCKED_FFT_LOG2_BLOCK_SIZE rounds only combine elements within
+ *     aligned blocks of 2^BLOCKED_FFT_LOG2_BLOCK_SIZE elements, so each block is taken through all of those rounds
+ *     while it sits in cache.
+ *  2. The remaining rounds are fused pairwise into radix-4 passes, halving the number of passes over the array.
+ * Work is split over (polynomial, block) and (polynomial, butterfly) pairs, so a batch of polynomials is transformed
+ * with the same twiddle tables and the same number of synchronisation points as a single one.
+ *
+ * @param inputs The polynomials to transform, in natural order
+ * @param outputs Where to write the evaluations; may alias inputs, in which case the transform is in place
+ * @param root_table The round roots of the domain (or its inverse round roots for an inverse transform)
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_blocked(std::span<Fr* const> inputs,
+                       std::span<Fr* const> outputs,
+                       const EvaluationDomain<Fr>& domain,
+                       const std::vector<Fr*>& root_table)
+{
+    ASSERT(inputs.size() == outputs.size());
+    const size_t num_polys = inputs.size();
+    const size_t n = domain.size;
+    const size_t log2_n = domain.log2_size;
+    if (num_polys == 0) {
+        return;
+    }
+    if (n == 1) {
+        for (size_t poly_idx = 0; poly_idx < num_polys; ++poly_idx) {
+            outputs[poly_idx][0] = inputs[poly_idx][0];
+        }
+        return;
+    }
+
+    // Bit-reversal permutation. In place, each pair is swapped by whichever thread owns its smaller index.
+    parallel_for_heuristic(
+        num_polys * n,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            for (size_t idx = start; idx < end; ++idx) {
+                const size_t poly_idx = idx >> log2_n;
+                const size_t i = idx & (n - 1);
+                const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(log2_n));
+                if (inputs[poly_idx] == outputs[poly_idx]) {
+                    if (i < swap_index) {
+                        Fr::__swap(outputs[poly_idx][i], outputs[poly_idx][swap_index]);
+                    }
+                } else {
+                    outputs[poly_idx][i] = inputs[poly_idx][swap_index];
+                }
+            }
+        },
+        thread_heuristics::FF_COPY_COST);
+
+    // Phase 1: all rounds that stay within a block. Blocks are shrunk when there would be too few to go around.
+    size_t log2_block_size = std::min(log2_n, BLOCKED_FFT_LOG2_BLOCK_SIZE);
+    while (log2_block_size > 1 && (num_polys << (log2_n - log2_block_size)) < get_num_cpus()) {
+        --log2_block_size;
+    }
+    const size_t block_size = 1UL << log2_block_size;
+    const size_t log2_blocks_per_poly = log2_n - log2_block_size;
+    parallel_for_heuristic(
+        num_polys << log2_blocks_per_poly,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            Fr temp;
+            for (size_t block_idx = start; block_idx < end; ++block_idx) {
+                Fr* block = outputs[block_idx >> log2_blocks_per_poly] +
+                            ((block_idx & ((1UL << log2_blocks_per_poly) - 1)) << log2_block_size);
+                // The first round's roots are all 1
+                for (size_t k = 0; k < block_size; k += 2) {
+                    Fr::__copy(block[k + 1], temp);
+                    block[k + 1] = block[k] - temp;
+                    block[k] += temp;
+                }
+                for (size_t m = 2; m < block_size; m <<= 1) {
+                    const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+                    for (size_t k = 0; k < block_size; k += 2 * m) {
+                        for (size_t j = 0; j < m; ++j) {
+                            temp = round_roots[j] * block[k + j + m];
+                            block[k + j + m] = block[k + j] - temp;
+                            block[k + j] += temp;
+                        }
+                    }
+                }
+            }
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * log2_block_size * (block_size >> 1));
+
+    // Phase 2: the remaining rounds, two at a time. If their number is odd, the first is done on its own.
+    size_t log2_m = log2_block_size;
+    if (((log2_n - log2_m) & 1) == 1) {
+        const size_t m = 1UL << log2_m;
+        const Fr* round_roots = root_table[log2_m - 1];
+        parallel_for_heuristic(
+            (num_polys * n) >> 1,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                Fr temp;
+                for (size_t idx = start; idx < end; ++idx) {
+                    Fr* poly = outputs[idx >> (log2_n - 1)];
+                    const size_t i = idx & ((n >> 1) - 1);
+                    const size_t j = i & (m - 1);
+                    const size_t k = (i >> log2_m) << (log2_m + 1);
+                    temp = round_roots[j] * poly[k + j + m];
+                    poly[k + j + m] = poly[k + j] - temp;
+                    poly[k + j] += temp;
+                }
+            },
+            thread_heuristics::FF_MULTIPLICATION_COST);
+        ++log2_m;
+    }
+    for (; log2_m < log2_n; log2_m += 2) {
+        const size_t m = 1UL << log2_m;
+        // Round m pairs (a, b) and (c, d) under the same root; round 2m then pairs (a, c) and (b, d)
+        const Fr* round_roots = root_table[log2_m - 1];
+        const Fr* next_round_roots = root_table[log2_m];
+        parallel_for_heuristic(
+            (num_polys * n) >> 2,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                Fr temp;
+                for (size_t idx = start; idx < end; ++idx) {
+                    Fr* poly = outputs[idx >> (log2_n - 2)];
+                    const size_t i = idx & ((n >> 2) - 1);
+                    const size_t j = i & (m - 1);
+                    Fr* a = poly + ((i >> log2_m) << (log2_m + 2)) + j;
+                    Fr* b = a + m;
+                    Fr* c = b + m;
+                    Fr* d = c + m;
+
+                    temp = round_roots[j] * *b;
+                    *b = *a - temp;
+                    *a += temp;
+                    temp = round_roots[j] * *d;
+                    *d = *c - temp;
+                    *c += temp;
+
+                    temp = next_round_roots[j] * *c;
+                    *c = *a - temp;
+                    *a += temp;
+                    temp = next_round_roots[j + m] * *d;
+                    *d = *b - temp;
+                    *b += temp;
+                }
+            },
+            thread_heuristics::FF_MULTIPLICATION_COST * 4);
+    }
+}
+
+/**
+ * @brief Transform a single polynomial, with the blocked NTT for large domains
+ * @details Reads coeffs and writes the evaluations to target, which may equal coeffs.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_single(
+    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr& root, const std::vector<Fr*>& root_table)
+{
+    if (domain.log2_size >= BLOCKED_FFT_MIN_LOG2_SIZE) {
+        fft_inner_blocked<Fr>({ &coeffs, 1 }, { &target, 1 }, domain, root_table);
+    } else if (coeffs == target) {
+        fft_inner_parallel({ coeffs }, domain, root, root_table);
+    } else {
+        fft_inner_parallel(coeffs, target, domain, root, root_table);
+    }
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -524,14 +690,14 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_inner_single(coeffs, coeffs, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root, domain.get_round_roots());
+    fft_inner_single(coeffs, target, domain, domain.root, domain.get_round_roots());
 }
 
 template <typename Fr>
@@ -545,7 +711,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner_single(coeffs, coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -555,7 +721,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
-    fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner_single(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
     ITERATE_OVER_DOMAIN_START(domain);
     target[i] *= domain.domain_inverse;
     ITERATE_OVER_DOMAIN_END;
@@ -583,7 +749,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root, domain.get_round_roots());
+    fft_inner_single(coeffs, coeffs, domain, domain.root, domain.get_round_roots());
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= value;
     ITERATE_OVER_DOMAIN_END;
@@ -650,11 +816,11 @@ void coset_fft(Fr* coeffs,
     }
 
     for (size_t i = 0; i < domain_extension; ++i) {
-        fft_inner_parallel(coeffs + (i * domain.size),
-                           scratch_space + (i * domain.size),
-                           domain,
-                           domain.root,
-                           domain.get_round_roots());
+        fft_inner_single(coeffs + (i * domain.size),
+                         scratch_space + (i * domain.size),
+                         domain,
+                         domain.root,
+                         domain.get_round_roots());
     }
 
     if (domain_extension == 4) {
@@ -704,7 +870,7 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr& value)
 {
-    fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    fft_inner_single(coeffs, coeffs, domain, domain.root_inverse, domain.get_inverse_round_roots());
     Fr T0 = domain.domain_inverse * value;
     ITERATE_OVER_DOMAIN_START(domain);
     coeffs[i] *= T0;
@@ -737,6 +903,48 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     }
 }
 
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_blocked(polynomials, polynomials, domain, domain.get_round_roots());
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_ifft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_blocked(polynomials, polynomials, domain, domain.get_inverse_round_roots());
+    parallel_for_heuristic(
+        polynomials.size() * domain.size,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            for (size_t idx = start; idx < end; ++idx) {
+                polynomials[idx >> domain.log2_size][idx & (domain.size - 1)] *= domain.domain_inverse;
+            }
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    for (Fr* coeffs : polynomials) {
+        scale_by_generator(coeffs, coeffs, domain, Fr::one(), domain.generator, domain.generator_size);
+    }
+    batch_fft(polynomials, domain);
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_ifft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain)
+{
+    batch_ifft(polynomials, domain);
+    for (Fr* coeffs : polynomials) {
+        scale_by_generator(coeffs, coeffs, domain, Fr::one(), domain.generator_inverse, domain.size);
+    }
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -1448,6 +1656,14 @@ template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_inner_blocked<fr>(std::span<fr* const>,
+                                    std::span<fr* const>,
+                                    const EvaluationDomain<fr>&,
+                                    const std::vector<fr*>&);
+template void batch_fft<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void batch_ifft<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void batch_coset_fft<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
+template void batch_coset_ifft<fr>(std::span<fr* const>, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void partial_fft_parellel_inner<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
 template void partial_fft_serial<fr>(fr*, fr*, const EvaluationDomain<fr>&);
@@ -1,5 +1,6 @@
 #pragma once
 #include "evaluation_domain.hpp"
+#include <span>
 
 namespace bb::polynomial_arithmetic {
 
@@ -95,6 +96,32 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+// Blocks of 2^12 field elements (128KiB) are taken through the first rounds of the blocked NTT while they sit in L2
+constexpr size_t BLOCKED_FFT_LOG2_BLOCK_SIZE = 12;
+// fft(), ifft() and their variants use the blocked NTT for domains of at least this size
+constexpr size_t BLOCKED_FFT_MIN_LOG2_SIZE = 12;
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void fft_inner_blocked(std::span<Fr* const> inputs,
+                       std::span<Fr* const> outputs,
+                       const EvaluationDomain<Fr>& domain,
+                       const std::vector<Fr*>& root_table);
+
+// In-place transforms of several independent polynomials over the same domain, sharing its twiddle tables
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_ifft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_ifft(std::span<Fr* const> polynomials, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -211,6 +211,73 @@ TEST(polynomials, fft_coset_ifft_consistency)
     }
 }
 
+/**
+ * @brief The blocked NTT used for larger domains must agree with the plain radix-2 transform, for both an odd and an
+ * even number of rounds left after the in-block rounds
+ */
+TEST(polynomials, blocked_fft_consistency)
+{
+    for (size_t log2_n : { polynomial_arithmetic::BLOCKED_FFT_MIN_LOG2_SIZE,
+                           polynomial_arithmetic::BLOCKED_FFT_MIN_LOG2_SIZE + 1,
+                           polynomial_arithmetic::BLOCKED_FFT_MIN_LOG2_SIZE + 2 }) {
+        const size_t n = 1UL << log2_n;
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<fr> coeffs(n);
+        for (auto& coeff : coeffs) {
+            coeff = fr::random_element();
+        }
+        std::vector<fr> expected = coeffs;
+        std::vector<fr> result(n);
+        polynomial_arithmetic::fft_inner_parallel({ expected.data() }, domain, domain.root, domain.get_round_roots());
+        fr* const input = coeffs.data();
+        fr* const output = result.data();
+        polynomial_arithmetic::fft_inner_blocked<fr>(
+            std::span(&input, 1), std::span(&output, 1), domain, domain.get_round_roots());
+
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(polynomials, batch_fft_consistency)
+{
+    constexpr size_t n = 1UL << (polynomial_arithmetic::BLOCKED_FFT_MIN_LOG2_SIZE + 1);
+    constexpr size_t num_poly = 3;
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    std::vector<std::vector<fr>> batch(num_poly, std::vector<fr>(n));
+    for (auto& poly : batch) {
+        for (auto& coeff : poly) {
+            coeff = fr::random_element();
+        }
+    }
+    const auto original = batch;
+    std::vector<fr*> polynomials;
+    for (auto& poly : batch) {
+        polynomials.push_back(poly.data());
+    }
+
+    polynomial_arithmetic::batch_coset_fft<fr>(polynomials, domain);
+    for (size_t j = 0; j < num_poly; ++j) {
+        auto expected = original[j];
+        polynomial_arithmetic::coset_fft(expected.data(), domain);
+        EXPECT_EQ(batch[j], expected);
+    }
+    polynomial_arithmetic::batch_coset_ifft<fr>(polynomials, domain);
+    EXPECT_EQ(batch, original);
+
+    polynomial_arithmetic::batch_fft<fr>(polynomials, domain);
+    for (size_t j = 0; j < num_poly; ++j) {
+        auto expected = original[j];
+        polynomial_arithmetic::fft(expected.data(), domain);
+        EXPECT_EQ(batch[j], expected);
+    }
+    polynomial_arithmetic::batch_ifft<fr>(polynomials, domain);
+    EXPECT_EQ(batch, original);
+}
+
 TEST(polynomials, split_polynomial_fft_coset_ifft_consistency)
 {
     constexpr size_t n = 256;
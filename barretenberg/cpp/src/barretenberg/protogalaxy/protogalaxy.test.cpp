@@ -229,6 +229,49 @@ template <typename Flavor> class ProtogalaxyTests : public testing::Test {
         EXPECT_EQ(perturbator[0], target_sum);
     }
 
+    /**
+     * @brief Check that the perturbator computed on the fly from the rows of the accumulator matches the one computed
+     * from the stored row evaluations, over a trace of several chunks
+     *
+     */
+    static void test_pertubator_polynomial_matches_row_evaluations()
+    {
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        const size_t log_size = PGInternal::LOG_PERTURBATOR_CHUNK_SIZE + 2;
+        const size_t size = 1UL << log_size;
+        ProverPolynomials full_polynomials;
+        for (auto& poly : full_polynomials.get_all()) {
+            poly = bb::Polynomial<FF>::random(size);
+        }
+
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+        std::vector<FF> betas(log_size);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        auto deltas = compute_round_challenge_pows(log_size, FF::random_element());
+
+        PGInternal pg_internal;
+        auto full_honk_evals = pg_internal.compute_row_evaluations(full_polynomials, alphas, relation_parameters);
+        auto expected_perturbator = PGInternal::construct_perturbator_coefficients(betas, deltas, full_honk_evals);
+
+        auto accumulator = std::make_shared<DeciderProvingKey>();
+        accumulator->proving_key.polynomials = std::move(full_polynomials);
+        accumulator->proving_key.log_circuit_size = log_size;
+        accumulator->gate_challenges = betas;
+        accumulator->relation_parameters = relation_parameters;
+        accumulator->alphas = alphas;
+        auto perturbator = pg_internal.compute_perturbator(accumulator, deltas);
+
+        for (size_t i = 0; i < expected_perturbator.size(); i++) {
+            EXPECT_EQ(perturbator[i], expected_perturbator[i]);
+        }
+    }
+
     /**
      * @brief Manually compute the expected evaluations of the combiner quotient, given evaluations of the combiner
      * and check them against the evaluations returned by the function.
@@ -582,6 +625,11 @@ TYPED_TEST(ProtogalaxyTests, PerturbatorPolynomial)
     TestFixture::test_pertubator_polynomial();
 }
 
+TYPED_TEST(ProtogalaxyTests, PerturbatorPolynomialMatchesRowEvaluations)
+{
+    TestFixture::test_pertubator_polynomial_matches_row_evaluations();
+}
+
 TYPED_TEST(ProtogalaxyTests, CombinerQuotient)
 {
     TestFixture::test_combiner_quotient();
@@ -9,6 +9,10 @@
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
 
+#include <array>
+#include <atomic>
+#include <span>
+
 namespace bb {
 
 /**
@@ -56,6 +60,10 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
 
     static constexpr size_t NUM_SUBRELATIONS = DeciderPKs::NUM_SUBRELATIONS;
 
+    // The perturbator is computed over chunks of 2^LOG_PERTURBATOR_CHUNK_SIZE rows, each reduced to a single node of the
+    // coefficient tree as the rows are evaluated. A chunk's partial subtrees take a few KB, so they stay in cache.
+    static constexpr size_t LOG_PERTURBATOR_CHUNK_SIZE = 10;
+
     ExecutionTraceUsageTracker trace_usage_tracker;
 
     ProtogalaxyProverInternal(ExecutionTraceUsageTracker trace_usage_tracker = ExecutionTraceUsageTracker{})
@@ -122,12 +130,7 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         const size_t polynomial_size = polynomials.get_polynomial_size();
         std::vector<FF> aggregated_relation_evaluations(polynomial_size);
 
-        const std::array<FF, NUM_SUBRELATIONS> alphas = [&alphas_]() {
-            std::array<FF, NUM_SUBRELATIONS> tmp;
-            tmp[0] = 1;
-            std::copy(alphas_.begin(), alphas_.end(), tmp.begin() + 1);
-            return tmp;
-        }();
+        const std::array<FF, NUM_SUBRELATIONS> alphas = get_subrelation_challenges(alphas_);
 
         // Determine the number of threads over which to distribute the work
         const size_t num_threads = compute_num_threads(polynomial_size);
@@ -161,34 +164,47 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return aggregated_relation_evaluations;
     }
     /**
-     * @brief  Recursively compute the parent nodes of each level in the tree, starting from the leaves. Note that at
-     * each level, the resulting parent nodes will be polynomials of degree (level+1) because we multiply by an
-     * additional factor of X.
+     * @brief Reduce a chunk of 2^log_chunk_size leaves, starting at leaf chunk_start, to its root in the coefficient
+     * tree of the perturbator (see construct_perturbator_coefficients)
+     * @details The leaves are consumed in order and merged like a binary counter: subtrees[h] holds a complete subtree of
+     * height h that waits for its right sibling, so only O(log_chunk_size^2) field elements are live at a time. A node
+     * at height h is a polynomial of degree h.
+     *
+     * @param get_leaf Returns the value of the leaf at a given index
+     * @param root The log_chunk_size + 1 coefficients of the root of the chunk
      */
-    static std::vector<FF> construct_coefficients_tree(std::span<const FF> betas,
-                                                       std::span<const FF> deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
+    template <typename GetLeaf>
+    static void reduce_perturbator_chunk(std::span<const FF> betas,
+                                         std::span<const FF> deltas,
+                                         const size_t chunk_start,
+                                         const size_t log_chunk_size,
+                                         GetLeaf& get_leaf,
+                                         std::span<FF> root)
     {
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width / 2, std::vector<FF>(degree + 1, 0));
-        parallel_for_heuristic(
-            prev_level_width / 2,
-            [&](size_t parent) {
-                size_t node = parent * 2;
-                std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-                for (size_t d = 0; d < degree; d++) {
-                    level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                    level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
+        ASSERT(log_chunk_size <= LOG_PERTURBATOR_CHUNK_SIZE);
+        std::array<std::array<FF, LOG_PERTURBATOR_CHUNK_SIZE + 1>, LOG_PERTURBATOR_CHUNK_SIZE> subtrees;
+        std::array<FF, LOG_PERTURBATOR_CHUNK_SIZE + 1> node;
+        const size_t chunk_size = 1UL << log_chunk_size;
+        for (size_t i = 0; i < chunk_size; i++) {
+            node[0] = get_leaf(chunk_start + i);
+            size_t height = 0;
+            // While the node is a right child, replace it with its parent left + node * (β_h + δ_h X)
+            while (height < log_chunk_size && ((i >> height) & 1) == 1) {
+                const auto& left = subtrees[height];
+                node[height + 1] = node[height] * deltas[height];
+                for (size_t d = height; d > 0; d--) {
+                    node[d] = left[d] + node[d] * betas[height] + node[d - 1] * deltas[height];
                 }
-            },
-            /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * degree * 3);
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
+                node[0] = left[0] + node[0] * betas[height];
+                height++;
+            }
+            if (height == log_chunk_size) {
+                std::copy(node.begin(), node.begin() + static_cast<std::ptrdiff_t>(height + 1), root.begin());
+            } else {
+                std::copy(
+                    node.begin(), node.begin() + static_cast<std::ptrdiff_t>(height + 1), subtrees[height].begin());
+            }
+        }
     }
 
     /**
@@ -198,44 +214,114 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     *
+     * @details The leaves are produced on the fly by get_leaf(leaf_idx, thread_idx), and never stored: threads take
+     * chunks of 2^LOG_PERTURBATOR_CHUNK_SIZE leaves and reduce each to its subtree root (see reduce_perturbator_chunk).
+     * The roots are kept in a single flat allocation with a fixed stride of log(width) + 1 coefficients, over which the
+     * remaining levels of the tree are computed in place: each parent overwrites its left child.
+     */
+    template <typename GetLeaf>
+    static std::vector<FF> construct_perturbator_coefficients(std::span<const FF> betas,
+                                                              std::span<const FF> deltas,
+                                                              const size_t num_threads,
+                                                              GetLeaf&& get_leaf)
+    {
+        const size_t log_width = betas.size();
+        const size_t log_chunk_size = std::min(log_width, LOG_PERTURBATOR_CHUNK_SIZE);
+        const size_t num_chunks = 1UL << (log_width - log_chunk_size);
+        const size_t stride = log_width + 1;
+
+        // The coefficients of node i of the current level are coeffs[i * stride, i * stride + level + 1)
+        std::vector<FF> coeffs(num_chunks * stride, FF(0));
+
+        // Chunks are handed out dynamically, as the cost of a chunk depends on how many of its rows are active
+        std::atomic<size_t> next_chunk = 0;
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            auto get_thread_leaf = [&](size_t leaf_idx) { return get_leaf(leaf_idx, thread_idx); };
+            for (size_t chunk = next_chunk++; chunk < num_chunks; chunk = next_chunk++) {
+                reduce_perturbator_chunk(betas,
+                                         deltas,
+                                         chunk << log_chunk_size,
+                                         log_chunk_size,
+                                         get_thread_leaf,
+                                         std::span{ coeffs }.subspan(chunk * stride, stride));
+            }
+        });
+
+        for (size_t level = log_chunk_size; level < log_width; level++) {
+            const size_t node_distance = 1UL << (level - log_chunk_size); // distance between siblings in the array
+            parallel_for_heuristic(
+                num_chunks >> (level - log_chunk_size + 1),
+                [&](size_t parent) {
+                    FF* left = &coeffs[2 * parent * node_distance * stride];
+                    const FF* right = left + (node_distance * stride);
+                    for (size_t d = 0; d <= level; d++) {
+                        left[d] += right[d] * betas[level];
+                        left[d + 1] += right[d] * deltas[level];
+                    }
+                },
+                /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * (level + 1) * 3);
+        }
+        coeffs.resize(stride);
+        return coeffs;
+    }
+
+    /**
+     * @brief Construct the perturbator coefficients from the stored evaluations of the full Honk relation at each row
      */
     static std::vector<FF> construct_perturbator_coefficients(std::span<const FF> betas,
                                                               std::span<const FF> deltas,
                                                               const std::vector<FF>& full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width / 2, std::vector<FF>(2, 0));
-        parallel_for_heuristic(
-            width / 2,
-            [&](size_t parent) {
-                size_t node = parent * 2;
-                first_level_coeffs[parent][0] =
-                    full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-                first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
-            },
-            /* overestimate */ thread_heuristics::FF_MULTIPLICATION_COST * 3);
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+        ASSERT(full_honk_evaluations.size() == (1UL << betas.size()));
+        return construct_perturbator_coefficients(
+            betas,
+            deltas,
+            compute_num_threads(full_honk_evaluations.size()),
+            [&](size_t leaf_idx, size_t /*thread_idx*/) { return full_honk_evaluations[leaf_idx]; });
     }
 
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator
+     * @details Fuses the computation of the row evaluations f_i(ω) (see compute_row_evaluations) with the construction
+     * of the coefficient tree, so that the evaluations are never stored for the full trace.
      */
     Polynomial<FF> compute_perturbator(const std::shared_ptr<const DeciderPK>& accumulator,
                                        const std::vector<FF>& deltas)
     {
         PROFILE_THIS();
-        auto full_honk_evaluations = compute_row_evaluations(
-            accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
+        const auto& polynomials = accumulator->proving_key.polynomials;
+        const auto& relation_parameters = accumulator->relation_parameters;
         const auto betas = accumulator->gate_challenges;
         ASSERT(betas.size() == deltas.size());
         const size_t log_circuit_size = accumulator->proving_key.log_circuit_size;
+        const size_t polynomial_size = polynomials.get_polynomial_size();
+        ASSERT(polynomial_size <= (1UL << log_circuit_size));
+
+        const std::array<FF, NUM_SUBRELATIONS> alphas = get_subrelation_challenges(accumulator->alphas);
+        const size_t num_threads = compute_num_threads(polynomial_size);
+        std::vector<FF> linearly_dependent_contribution_accumulators(num_threads);
 
         // Compute the perturbator using only the first log_circuit_size-many betas/deltas
-        std::vector<FF> perturbator = construct_perturbator_coefficients(std::span{ betas.data(), log_circuit_size },
-                                                                         std::span{ deltas.data(), log_circuit_size },
-                                                                         full_honk_evaluations);
+        std::vector<FF> perturbator = construct_perturbator_coefficients(
+            std::span{ betas.data(), log_circuit_size },
+            std::span{ deltas.data(), log_circuit_size },
+            num_threads,
+            [&](size_t idx, size_t thread_idx) {
+                // The contribution is only non-trivial at a given row if the accumulator is active at that row
+                if (idx >= polynomial_size || !trace_usage_tracker.check_is_active(idx)) {
+                    return FF(0);
+                }
+                const AllValues row = polynomials.get_row(idx);
+                const RelationEvaluations evals =
+                    RelationUtils::accumulate_relation_evaluations(row, relation_parameters, FF(1));
+                return process_subrelation_evaluations(
+                    evals, alphas, linearly_dependent_contribution_accumulators[thread_idx]);
+            });
+
+        // The linearly dependent contribution belongs to row 0, the leftmost leaf, whose path to the root only has
+        // branches labelled 1, so it only adds to the constant coefficient
+        perturbator[0] += sum(linearly_dependent_contribution_accumulators);
 
         // Populate the remaining coefficients with zeros to reach the required constant size
         for (size_t idx = log_circuit_size; idx < CONST_PG_LOG_N; ++idx) {
@@ -582,6 +668,17 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return result;
     }
 
+    /**
+     * @brief Prepend the challenge 1 for the first subrelation to the subrelation separators 'alphas'
+     */
+    static std::array<FF, NUM_SUBRELATIONS> get_subrelation_challenges(const RelationSeparator& alphas)
+    {
+        std::array<FF, NUM_SUBRELATIONS> challenges;
+        challenges[0] = 1;
+        std::copy(alphas.begin(), alphas.end(), challenges.begin() + 1);
+        return challenges;
+    }
+
     /**
      * @brief Determine number of threads for multithreading of perterbator/combiner operations
      * @details Potentially uses fewer threads than are available to avoid distributing very small amounts of work
@@ -0,0 +1,156 @@
+#ifndef __wasm__
+#include "point_table_cache.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace bb::srs::factories {
+
+namespace {
+
+template <typename Curve> PointTableCacheHeader make_header(size_t num_points)
+{
+    PointTableCacheHeader header{};
+    header.magic = PointTableCacheHeader::MAGIC;
+    header.version = PointTableCacheHeader::VERSION;
+    header.element_size = sizeof(typename Curve::AffineElement);
+    header.num_points = num_points;
+    std::strncpy(header.curve_name, Curve::name, sizeof(header.curve_name) - 1);
+    return header;
+}
+
+template <typename Curve> bool is_valid_header(PointTableCacheHeader const& header)
+{
+    auto expected = make_header<Curve>(header.num_points);
+    return header.magic == expected.magic && header.version == expected.version &&
+           header.element_size == expected.element_size &&
+           std::strncmp(header.curve_name, expected.curve_name, sizeof(header.curve_name)) == 0;
+}
+
+size_t round_up_to_page(size_t size)
+{
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (size + page_size - 1) / page_size * page_size;
+}
+
+} // namespace
+
+template <typename Curve>
+void write_point_table_cache(std::string const& path, std::span<const typename Curve::AffineElement> points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_points = points.size();
+
+    std::vector<AffineElement> table(num_points * 2);
+    if (num_points > 0) {
+        scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), table.data(), num_points);
+    }
+
+    std::vector<char> header_buf(POINT_TABLE_CACHE_DATA_OFFSET, 0);
+    auto header = make_header<Curve>(num_points);
+    std::memcpy(header_buf.data(), &header, sizeof(header));
+
+    // Write-then-rename so that concurrent provers only ever map complete files.
+    const std::string tmp_path = path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(tmp_path, std::ios::binary);
+        if (!file) {
+            throw_or_abort("Failed to open point table cache for writing: " + tmp_path);
+        }
+        file.write(header_buf.data(), static_cast<std::streamsize>(header_buf.size()));
+        file.write(reinterpret_cast<const char*>(table.data()),
+                   static_cast<std::streamsize>(table.size() * sizeof(AffineElement)));
+        if (!file) {
+            throw_or_abort("Failed to write point table cache: " + tmp_path);
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        throw_or_abort("Failed to move point table cache into place: " + path);
+    }
+}
+
+template <typename Curve> size_t get_point_table_cache_size(std::string const& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return 0;
+    }
+    const auto file_size = static_cast<size_t>(file.tellg());
+    if (file_size < POINT_TABLE_CACHE_DATA_OFFSET) {
+        return 0;
+    }
+    PointTableCacheHeader header{};
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || !is_valid_header<Curve>(header)) {
+        return 0;
+    }
+    // Guard against truncated files, mapping past the end of a file faults on access.
+    if (file_size < POINT_TABLE_CACHE_DATA_OFFSET + header.num_points * 2 * header.element_size) {
+        return 0;
+    }
+    return header.num_points;
+}
+
+template <typename Curve>
+MmapProverCrs<Curve>::MmapProverCrs(std::string const& path, size_t num_points)
+    : num_points(num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    PROFILE_THIS_NAME("MmapProverCrs constructor");
+
+    if (get_point_table_cache_size<Curve>(path) < num_points) {
+        throw_or_abort("Point table cache at " + path + " holds fewer than " + std::to_string(num_points) + " points.");
+    }
+
+    // Reserve the whole table, including pippenger's prefetch overflow, as zeroed anonymous memory, then map the file
+    // contents over the front of the reservation.
+    const size_t reserved_size = round_up_to_page(scalar_multiplication::point_table_size(num_points) *
+                                                  sizeof(AffineElement));
+    const size_t data_size = num_points * 2 * sizeof(AffineElement);
+
+    void* reservation = mmap(nullptr, reserved_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reservation == MAP_FAILED) {
+        throw_or_abort("Failed to reserve memory for point table cache.");
+    }
+    if (data_size > 0) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            munmap(reservation, reserved_size);
+            throw_or_abort("Failed to open point table cache: " + path);
+        }
+        void* mapped = mmap(reservation,
+                            data_size,
+                            PROT_READ,
+                            MAP_PRIVATE | MAP_FIXED,
+                            fd,
+                            static_cast<off_t>(POINT_TABLE_CACHE_DATA_OFFSET));
+        close(fd);
+        if (mapped == MAP_FAILED) {
+            munmap(reservation, reserved_size);
+            throw_or_abort("Failed to mmap point table cache: " + path);
+        }
+    }
+
+    monomials_ = std::shared_ptr<AffineElement[]>(static_cast<AffineElement*>(reservation),
+                                                  [reserved_size](AffineElement* ptr) { munmap(ptr, reserved_size); });
+}
+
+template void write_point_table_cache<curve::BN254>(std::string const&, std::span<const curve::BN254::AffineElement>);
+template void write_point_table_cache<curve::Grumpkin>(std::string const&,
+                                                       std::span<const curve::Grumpkin::AffineElement>);
+template size_t get_point_table_cache_size<curve::BN254>(std::string const&);
+template size_t get_point_table_cache_size<curve::Grumpkin>(std::string const&);
+template class MmapProverCrs<curve::BN254>;
+template class MmapProverCrs<curve::Grumpkin>;
+
+} // namespace bb::srs::factories
+#endif
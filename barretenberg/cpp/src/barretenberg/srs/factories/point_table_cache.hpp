@@ -0,0 +1,74 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of an on-disk pippenger point table cache
+ *
+ * @details The cache holds exactly what ProverCrs::get_monomial_points() returns, i.e. the raw in-memory
+ * (Montgomery form) affine elements with the endomorphism point interleaved after each SRS point:
+ *
+ * 00000 | header (this struct), zero padded to POINT_TABLE_CACHE_DATA_OFFSET
+ * 10000 | P_0, (\beta * P_0.x, -P_0.y), P_1, (\beta * P_1.x, -P_1.y), ... (2 * num_points elements)
+ *
+ * The data offset is a multiple of every common page size (4K/16K/64K) so that the table can be mmap'ed directly.
+ * Because the layout is the in-memory layout, a cache file is only valid on a machine with the same endianness as the
+ * one that wrote it.
+ */
+struct PointTableCacheHeader {
+    static constexpr uint64_t MAGIC = 0x454c424154504242; // "BBPTABLE" read as a little endian uint64
+    static constexpr uint32_t VERSION = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t num_points;
+    char curve_name[16];
+};
+
+static constexpr size_t POINT_TABLE_CACHE_DATA_OFFSET = 1 << 16;
+
+/**
+ * @brief Build the pippenger point table of the given SRS points and write it to `path`
+ * @details The file is written to a temporary path first and renamed into place, so that concurrent readers never
+ * observe a partially written cache.
+ */
+template <typename Curve>
+void write_point_table_cache(std::string const& path, std::span<const typename Curve::AffineElement> points);
+
+/**
+ * @brief Returns the number of SRS points held by the cache at `path`, or 0 if it is missing or not a valid cache for
+ * this curve.
+ */
+template <typename Curve> size_t get_point_table_cache_size(std::string const& path);
+
+/**
+ * @brief A prover CRS whose pippenger point table is mmap'ed read-only from a point table cache
+ * @details No points are parsed or converted at startup, and all processes mapping the same cache share a single copy
+ * in the page cache. The mapping is padded with zeroed anonymous memory to point_table_size(num_points) elements to
+ * cover pippenger's prefetch overflow.
+ */
+template <typename Curve> class MmapProverCrs : public ProverCrs<Curve> {
+  public:
+    MmapProverCrs(std::string const& path, size_t num_points);
+
+    std::span<typename Curve::AffineElement> get_monomial_points() override
+    {
+        return { monomials_.get(), num_points * 2 };
+    }
+
+    size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    size_t num_points;
+    std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+};
+
+} // namespace bb::srs::factories
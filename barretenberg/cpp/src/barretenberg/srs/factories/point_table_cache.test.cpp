@@ -0,0 +1,48 @@
+#ifndef __wasm__
+#include "point_table_cache.hpp"
+#include "../io.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/srs/factories/mem_prover_crs.hpp"
+#include <cstdio>
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::srs::factories;
+using namespace bb::curve;
+
+TEST(reference_string, point_table_cache_consistency)
+{
+    constexpr size_t num_points = 1024;
+    std::vector<g1::affine_element> points(num_points);
+    ::srs::IO<BN254>::read_transcript_g1(points.data(), num_points, "../srs_db/ignition");
+
+    const std::string cache_path = "point_table_cache_consistency.dat";
+    write_point_table_cache<BN254>(cache_path, points);
+    EXPECT_EQ(get_point_table_cache_size<BN254>(cache_path), num_points);
+    // A cache is tied to its curve.
+    EXPECT_EQ(get_point_table_cache_size<Grumpkin>(cache_path), 0);
+
+    MemProverCrs<BN254> mem_crs(points);
+    {
+        // Mapping a prefix of the cache gives the point table of the prefix.
+        MmapProverCrs<BN254> mmap_crs(cache_path, num_points / 2);
+        EXPECT_EQ(mmap_crs.get_monomial_size(), num_points / 2);
+        EXPECT_EQ(memcmp(mem_crs.get_monomial_points().data(),
+                         mmap_crs.get_monomial_points().data(),
+                         sizeof(g1::affine_element) * num_points),
+                  0);
+    }
+    MmapProverCrs<BN254> mmap_crs(cache_path, num_points);
+    EXPECT_EQ(memcmp(mem_crs.get_monomial_points().data(),
+                     mmap_crs.get_monomial_points().data(),
+                     sizeof(g1::affine_element) * num_points * 2),
+              0);
+
+    std::remove(cache_path.c_str());
+}
+
+TEST(reference_string, point_table_cache_rejects_missing_file)
+{
+    EXPECT_EQ(get_point_table_cache_size<BN254>("no_such_point_table_cache.dat"), 0);
+}
+#endif
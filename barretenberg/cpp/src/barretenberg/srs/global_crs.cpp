@@ -3,6 +3,7 @@
 #include "./factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/point_table_cache.hpp"
 
 namespace {
 // TODO(#637): As a PoC we have two global variables for the two CRS but this could be improved to avoid duplication.
@@ -18,6 +19,17 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
     crs_factory = std::make_shared<factories::MemBn254CrsFactory>(points, g2_point);
 }
 
+#ifndef __wasm__
+// Initializes the crs from a pippenger point table cache, sharing the mapped pages with other processes
+void init_crs_factory_from_point_table_cache(std::string const& cache_path,
+                                             size_t num_points,
+                                             g2::affine_element const g2_point)
+{
+    auto prover_crs = std::make_shared<factories::MmapProverCrs<curve::BN254>>(cache_path, num_points);
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(prover_crs, g2_point);
+}
+#endif
+
 // Initializes crs from a file path this we use in the entire codebase
 void init_crs_factory(std::string crs_path)
 {
@@ -12,6 +12,13 @@ void init_grumpkin_crs_factory(std::string crs_path);
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
 void init_crs_factory(std::vector<bb::g1::affine_element> const& points, bb::g2::affine_element const g2_point);
 
+#ifndef __wasm__
+// Initializes the crs by mmap'ing a pippenger point table cache (see factories/point_table_cache.hpp)
+void init_crs_factory_from_point_table_cache(std::string const& cache_path,
+                                             size_t num_points,
+                                             bb::g2::affine_element const g2_point);
+#endif
+
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory();
 std::shared_ptr<factories::CrsFactory<curve::Grumpkin>> get_grumpkin_crs_factory();
 
@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/gate_data.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
+#include <limits>
 #include <msgpack/sbuffer_decl.hpp>
 #include <utility>
 
@@ -11,6 +12,8 @@
 
 namespace bb {
 static constexpr uint32_t DUMMY_TAG = 0;
+// The entry of CircuitBuilderBase::tau of a tag which has not been mapped by create_tag()
+static constexpr uint32_t UNSET_TAU = std::numeric_limits<uint32_t>::max();
 
 template <typename FF_> class CircuitBuilderBase {
   public:
@@ -34,7 +37,9 @@ template <typename FF_> class CircuitBuilderBase {
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
     // DOCTODO(#231): replace with the relevant wiki link.
-    std::map<uint32_t, uint32_t> tau;
+    // Tags are consecutive integers handed out from current_tag, so the permutation is a flat table indexed by tag,
+    // holding UNSET_TAU for the tags which have not been mapped.
+    std::vector<uint32_t> tau;
 
     // Public input indices which contain recursive proof information
     PairingPointAccumPubInputIndices pairing_point_accumulator_public_input_indices;
@@ -54,6 +59,12 @@ template <typename FF_> class CircuitBuilderBase {
 
     CircuitBuilderBase(size_t size_hint = 0);
 
+    /**
+     * @brief Reserve the per-variable bookkeeping for num_variables variables
+     * @details Variable names are only ever set for debugging, so no space is reserved for them.
+     */
+    void reserve_variables(size_t num_variables);
+
     CircuitBuilderBase(const CircuitBuilderBase& other) = default;
     CircuitBuilderBase(CircuitBuilderBase&& other) noexcept = default;
     CircuitBuilderBase& operator=(const CircuitBuilderBase& other) = default;
@@ -5,12 +5,16 @@
 namespace bb {
 template <typename FF_> CircuitBuilderBase<FF_>::CircuitBuilderBase(size_t size_hint)
 {
-    variables.reserve(size_hint * 3);
-    variable_names.reserve(size_hint * 3);
-    next_var_index.reserve(size_hint * 3);
-    prev_var_index.reserve(size_hint * 3);
-    real_variable_index.reserve(size_hint * 3);
-    real_variable_tags.reserve(size_hint * 3);
+    reserve_variables(size_hint * 3);
+}
+
+template <typename FF_> void CircuitBuilderBase<FF_>::reserve_variables(size_t num_variables)
+{
+    variables.reserve(num_variables);
+    next_var_index.reserve(num_variables);
+    prev_var_index.reserve(num_variables);
+    real_variable_index.reserve(num_variables);
+    real_variable_tags.reserve(num_variables);
 }
 
 template <typename FF_> size_t CircuitBuilderBase<FF_>::get_num_finalized_gates() const
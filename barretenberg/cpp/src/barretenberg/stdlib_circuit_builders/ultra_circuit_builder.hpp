@@ -12,6 +12,7 @@
 // TODO(md): note that this has now been added
 #include "circuit_builder_base.hpp"
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "barretenberg/serialize/cbind.hpp"
@@ -295,15 +296,26 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     // Storage for wires and selectors for all gate types
     GateBlocks blocks;
 
+    // Hashes the canonical (reduced) Montgomery limbs, consistent with FF::operator==
+    struct ConstantHash {
+        size_t operator()(const FF& value) const
+        {
+            const FF reduced = value.reduce_once();
+            return static_cast<size_t>(reduced.data[0] ^ reduced.data[1] ^ reduced.data[2] ^ reduced.data[3]);
+        }
+    };
+
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
-    std::map<FF, uint32_t> constant_variable_indices;
+    std::unordered_map<FF, uint32_t, ConstantHash> constant_variable_indices;
 
     // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
     std::vector<plookup::BasicTable> lookup_tables;
 
-    std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    // One list per distinct target range. There are only a handful of these and they are processed in order of
+    // target range, which fixes the layout of the sort constraint gates, so this stays an ordered map.
+    std::map<uint64_t, RangeList> range_lists;
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
@@ -337,7 +349,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/870): reserve space in blocks here somehow?
         this->zero_idx = put_constant_variable(FF::zero());
-        this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
+        this->tau.push_back(DUMMY_TAG); // tau(DUMMY_TAG) = DUMMY_TAG. TODO(luke): explain this
     };
     /**
      * @brief Constructor from data generated from ACIR
@@ -361,7 +373,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         : CircuitBuilderBase<FF>(size_hint)
     {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/870): reserve space in blocks here somehow?
-
+        this->reserve_variables(varnum);
         for (size_t idx = 0; idx < varnum; ++idx) {
             // Zeros are added for variables whose existence is known but whose values are not yet known. The values may
             // be "set" later on via the assert_equal mechanism.
@@ -375,7 +387,7 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
         // Add the const zero variable after the acir witness has been
         // incorporated into variables.
         this->zero_idx = put_constant_variable(FF::zero());
-        this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
+        this->tau.push_back(DUMMY_TAG); // tau(DUMMY_TAG) = DUMMY_TAG. TODO(luke): explain this
 
         this->is_recursive_circuit = recursive;
     };
@@ -383,32 +395,34 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
     UltraCircuitBuilder_(UltraCircuitBuilder_&& other)
         : CircuitBuilderBase<FF>(std::move(other))
     {
-        blocks = other.blocks;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        blocks = std::move(other.blocks);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
     };
     UltraCircuitBuilder_& operator=(const UltraCircuitBuilder_& other) = default;
     UltraCircuitBuilder_& operator=(UltraCircuitBuilder_&& other)
     {
         CircuitBuilderBase<FF>::operator=(std::move(other));
-        blocks = other.blocks;
-        constant_variable_indices = other.constant_variable_indices;
-
-        lookup_tables = other.lookup_tables;
-        range_lists = other.range_lists;
-        ram_arrays = other.ram_arrays;
-        rom_arrays = other.rom_arrays;
-        memory_read_records = other.memory_read_records;
-        memory_write_records = other.memory_write_records;
-        cached_partial_non_native_field_multiplications = other.cached_partial_non_native_field_multiplications;
+        blocks = std::move(other.blocks);
+        constant_variable_indices = std::move(other.constant_variable_indices);
+
+        lookup_tables = std::move(other.lookup_tables);
+        range_lists = std::move(other.range_lists);
+        ram_arrays = std::move(other.ram_arrays);
+        rom_arrays = std::move(other.rom_arrays);
+        memory_read_records = std::move(other.memory_read_records);
+        memory_write_records = std::move(other.memory_write_records);
+        cached_partial_non_native_field_multiplications =
+            std::move(other.cached_partial_non_native_field_multiplications);
         circuit_finalized = other.circuit_finalized;
         return *this;
     };
@@ -788,7 +802,12 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename Arithmetization_
 
     uint32_t create_tag(const uint32_t tag_index, const uint32_t tau_index)
     {
-        this->tau.insert({ tag_index, tau_index });
+        if (this->tau.size() <= tag_index) {
+            this->tau.resize(tag_index + 1, UNSET_TAU);
+        }
+        // A tag is mapped once, mapping it again would silently change the permutation
+        ASSERT(this->tau[tag_index] == UNSET_TAU);
+        this->tau[tag_index] = tau_index;
         this->current_tag++; // Why exactly?
         return this->current_tag;
     }
@@ -562,17 +562,6 @@ class UltraFlavor {
 
       public:
         PartiallyEvaluatedMultivariates() = default;
-        PartiallyEvaluatedMultivariates(const size_t circuit_size)
-        {
-
-            PROFILE_THIS_NAME("PartiallyEvaluatedMultivariates constructor");
-
-            // Storage is only needed after the first partial evaluation, hence polynomials of
-            // size (n / 2)
-            for (auto& poly : this->get_all()) {
-                poly = Polynomial(circuit_size / 2);
-            }
-        }
     };
 
     /**
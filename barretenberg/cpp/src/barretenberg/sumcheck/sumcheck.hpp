@@ -118,6 +118,7 @@ template <typename Flavor> class SumcheckProver {
 
   public:
     using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
     using ProverPolynomials = typename Flavor::ProverPolynomials;
     using PartiallyEvaluatedMultivariates = typename Flavor::PartiallyEvaluatedMultivariates;
     using ClaimedEvaluations = typename Flavor::AllValues;
@@ -162,6 +163,8 @@ template <typename Flavor> class SumcheckProver {
     * @brief Container for partially evaluated Prover Polynomials at a current challenge. Upon computing challenge \f$
     u_i \f$, the first \f$2^{d-1-i}\f$ rows are updated using \ref bb::SumcheckProver< Flavor >::partially_evaluate
     "partially evaluate" method.
+    * The polynomials are allocated by the first partial evaluation, each one only over the image of the memory-backed
+    range of the corresponding prover polynomial, and shrink by half with every round.
     *
     * NOTE: With ~40 columns, prob only want to allocate 256 EdgeGroup's at once to keep stack under 1MB?
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
@@ -172,8 +175,7 @@ template <typename Flavor> class SumcheckProver {
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
-        , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , round(multivariate_n){};
 
     /**
      * @brief Compute round univariate, place it in transcript, compute challenge, partially evaluate. Repeat
@@ -218,9 +220,7 @@ template <typename Flavor> class SumcheckProver {
                 update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
             };
             gate_separators.partially_evaluate(round_challenge);
-            round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
-                                                      // release memory?        // All but final round
-                                                      // We operate on partially_evaluated_polynomials in place.
+            round.round_size = round.round_size >> 1;
         }
         for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
 
@@ -312,6 +312,8 @@ template <typename Flavor> class SumcheckProver {
     \ell+1,j} - \texttt{partially_evaluated_polynomials}_{2\ell,j}) \f} where \f$\vec \ell \in \{0,1\}^{d-1-i}\f$.
      * After the final update, i.e. when \f$ i = d-1 \f$, the upper row of the table contains the evaluations of Honk
      * polynomials at the challenge point \f$ (u_0,\ldots, u_{d-1}) \f$.
+     * Rows outside of the memory-backed range \f$ [s, e) \f$ of a polynomial are zero, and stay zero under partial
+     * evaluation, so the result is only computed and allocated over \f$ [\lfloor s/2 \rfloor, \lceil e/2 \rceil) \f$.
      * @param polynomials Honk polynomials at initialization; partially evaluated polynomials in subsequent rounds
      * @param round_size \f$2^{d-i}\f$
      * @param round_challenge \f$u_i\f$
@@ -320,11 +322,12 @@ template <typename Flavor> class SumcheckProver {
     {
         auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
+        // after the first round, the result replaces the corresponding partially_evaluated_polynomials
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j].at(i >> 1) = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
-            }
+            const auto& poly = poly_view[j];
+            const size_t end = std::min(poly.end_index(), round_size);
+            const size_t start = std::min(poly.start_index(), end);
+            pep_view[j] = partially_evaluate_range(poly, start, end, round_size, round_challenge);
         });
     };
     /**
@@ -335,15 +338,31 @@ template <typename Flavor> class SumcheckProver {
     void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
     {
         auto pep_view = partially_evaluated_polynomials.get_all();
-        // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j].at(i >> 1) =
-                    polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
-            }
+            pep_view[j] = partially_evaluate_range(polynomials[j], 0, round_size, round_size, round_challenge);
         });
     };
 
+    /**
+     * @brief Partially evaluate the rows \f$ [start, end) \f$ of a polynomial, which contain all of its non-zero
+     * entries, at the round challenge
+     */
+    template <typename PolynomialT>
+    static Polynomial partially_evaluate_range(
+        const PolynomialT& polynomial, size_t start, size_t end, size_t round_size, FF round_challenge)
+    {
+        const size_t result_start = start >> 1;
+        const size_t result_end = (end + 1) >> 1;
+        Polynomial result(
+            result_end - result_start, round_size >> 1, result_start, Polynomial::DontZeroMemory::FLAG);
+        for (size_t i = result_start; i < result_end; i++) {
+            const FF& even = polynomial[2 * i];
+            const FF& odd = polynomial[(2 * i) + 1];
+            result.at(i) = even + round_challenge * (odd - even);
+        }
+        return result;
+    };
+
     /**
     * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
     * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
@@ -116,6 +116,57 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    /**
+     * @brief Check that sumcheck over polynomials backed only on small ranges agrees with sumcheck over the same
+     * polynomials fully backed in memory
+     * @details Exercises partial evaluation of the backed ranges and the restriction of the rounds to their hull.
+     */
+    void test_sparse_polynomials()
+    {
+        const size_t multivariate_d(5);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Back every polynomial on a short range somewhere within rows [3, 27), with odd and even ends
+        std::vector<Polynomial<FF>> sparse_polynomials(NUM_POLYNOMIALS);
+        std::vector<Polynomial<FF>> dense_polynomials(NUM_POLYNOMIALS);
+        for (size_t idx = 0; idx < NUM_POLYNOMIALS; idx++) {
+            const size_t start = 3 + (idx % 7);
+            const size_t size = 1 + ((5 * idx) % 17);
+            sparse_polynomials[idx] = Polynomial<FF>::random(size, multivariate_n, start);
+            dense_polynomials[idx] = sparse_polynomials[idx].full();
+        }
+
+        const auto prove = [&](auto& input_polynomials) {
+            auto full_polynomials = construct_ultra_full_polynomials(input_polynomials);
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            RelationParameters<FF> relation_parameters{ .beta = FF(2), .gamma = FF(3), .public_input_delta = FF(1) };
+            return sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+        };
+        auto sparse_output = prove(sparse_polynomials);
+        auto dense_output = prove(dense_polynomials);
+
+        // The challenges are derived from the round univariates, so they agree only if every round univariate does
+        EXPECT_EQ(sparse_output.challenge, dense_output.challenge);
+        std::vector<FF> u_challenge(sparse_output.challenge.begin(), sparse_output.challenge.begin() + multivariate_d);
+        for (auto [poly, sparse_eval, dense_eval] : zip_view(dense_polynomials,
+                                                             sparse_output.claimed_evaluations.get_all(),
+                                                             dense_output.claimed_evaluations.get_all())) {
+            EXPECT_EQ(sparse_eval, dense_eval);
+            EXPECT_EQ(poly.evaluate_mle(u_challenge), sparse_eval);
+        }
+    }
+
     void test_prover()
     {
         const size_t multivariate_d(2);
@@ -361,6 +412,11 @@ TYPED_TEST(SumcheckTests, PolynomialNormalization)
     SKIP_IF_ZK();
     this->test_polynomial_normalization();
 }
+TYPED_TEST(SumcheckTests, SparsePolynomials)
+{
+    SKIP_IF_ZK();
+    this->test_sparse_polynomials();
+}
 // Test the prover
 TYPED_TEST(SumcheckTests, Prover)
 {
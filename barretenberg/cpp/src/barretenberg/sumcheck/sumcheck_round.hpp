@@ -18,7 +18,9 @@ method \ref bb::SumcheckProverRound< Flavor >::compute_univariate "compute univa
 implementation consists of the following sub-methods:
 
  - \ref bb::SumcheckProverRound::extend_edges "Extend evaluations" of linear univariate
- polynomials \f$ P_j(u_0,\ldots, u_{i-1}, X_i, \vec \ell) \f$ to the domain \f$0,\ldots, D\f$.
+ polynomials \f$ P_j(u_0,\ldots, u_{i-1}, X_i, \vec \ell) \f$ to the domain \f$0,\ldots, D\f$. Edges are read in
+ cache-resident tiles of all polynomials (\ref bb::SumcheckProverRound::load_edge_tile "load edge tile"), and edges on
+ which every relation is inactive are not extended at all.
  - \ref bb::SumcheckProverRound::accumulate_relation_univariates "Accumulate per-relation contributions" of the extended
 polynomials to \f$ T^i(X_i)\f$
  - \ref bb::SumcheckProverRound::extend_and_batch_univariates "Extend and batch the subrelation contibutions"
@@ -61,6 +63,22 @@ template <typename Flavor> class SumcheckProverRound {
      */
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
     using SumcheckRoundUnivariate = bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>;
+    /**
+     * @brief The two rows of an edge for every polynomial, before extension.
+     * @details Relation skip conditions are affine in the prover polynomials, so they hold on the extended edge
+     * exactly when they hold on these two rows. Checking them here is cheaper and lets us avoid extending inactive
+     * edges at all.
+     */
+    using EdgePairs = typename Flavor::template ProverUnivariates<2>;
+    /**
+     * @brief Number of edges loaded per tile, sized so that the tile of all polynomials stays cache resident
+     */
+    static constexpr size_t EDGE_TILE_SIZE =
+        std::max<size_t>((size_t(1) << 16) / (2 * sizeof(FF) * Flavor::NUM_ALL_ENTITIES), 1);
+    /**
+     * @brief Structure-of-arrays tile holding \ref EDGE_TILE_SIZE "EDGE_TILE_SIZE" edges of every polynomial
+     */
+    using EdgeTile = std::array<std::array<FF, 2 * EDGE_TILE_SIZE>, Flavor::NUM_ALL_ENTITIES>;
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
@@ -112,6 +130,57 @@ template <typename Flavor> class SumcheckProverRound {
         }
     }
 
+    /**
+     * @brief Copy rows \f$ [row\_start, row\_start + num\_rows) \f$ of every polynomial into a tile
+     * @details Each polynomial is read as one contiguous run, and only its memory-backed range is touched; rows outside
+     * of it are zero. The tile is then consumed edge by edge from cache instead of gathering from every polynomial's
+     * allocation for each edge.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    static void load_edge_tile(EdgeTile& tile,
+                               const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                               const size_t row_start,
+                               const size_t num_rows)
+    {
+        const size_t row_end = row_start + num_rows;
+        size_t poly_idx = 0;
+        for (auto& multivariate : multivariates.get_all()) {
+            auto& column = tile[poly_idx++];
+            const size_t lo = std::clamp(multivariate.start_index(), row_start, row_end);
+            const size_t hi = std::clamp(multivariate.end_index(), lo, row_end);
+            std::fill(column.begin(), column.begin() + static_cast<std::ptrdiff_t>(lo - row_start), FF(0));
+            if (lo < hi) {
+                const FF* data = multivariate.data() + (lo - multivariate.start_index());
+                std::copy(data, data + (hi - lo), column.begin() + static_cast<std::ptrdiff_t>(lo - row_start));
+            }
+            std::fill(column.begin() + static_cast<std::ptrdiff_t>(hi - row_start),
+                      column.begin() + static_cast<std::ptrdiff_t>(num_rows),
+                      FF(0));
+        }
+    }
+
+    /**
+     * @brief Read the edge starting at row \f$ row \f$ of a tile
+     */
+    static void load_tile_edge(EdgePairs& edge, const EdgeTile& tile, const size_t row)
+    {
+        size_t poly_idx = 0;
+        for (auto& edge_pair : edge.get_all()) {
+            edge_pair = bb::Univariate<FF, 2>({ tile[poly_idx][row], tile[poly_idx][row + 1] });
+            poly_idx++;
+        }
+    }
+
+    /**
+     * @brief Extend an edge read from a tile, see \ref extend_edges "extend edges"
+     */
+    static void extend_tile_edge(ExtendedEdges& extended_edges, const EdgePairs& edge)
+    {
+        for (auto [extended_edge, edge_pair] : zip_view(extended_edges.get_all(), edge.get_all())) {
+            extended_edge = edge_pair.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+        }
+    }
+
     /**
      * @brief Return the evaluations of the univariate round polynomials \f$ \tilde{S}_{i} (X_{i}) \f$  at \f$ X_{i } =
      0,\ldots, D \f$. Most likely, \f$ D \f$ is around  \f$ 12 \f$. At the
@@ -145,13 +214,17 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        // Only edges within the memory-backed range of some polynomial need to be visited
+        const auto [active_start, active_end] = get_active_range(polynomials);
+        const size_t num_active_rows = active_end - active_start;
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads_pow2(num_active_rows, min_iterations_per_thread);
+        // actual iterations per thread, rounded up to a whole number of edges
+        size_t iterations_per_thread = (((num_active_rows >> 1) + num_threads - 1) / num_threads) << 1;
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -159,26 +232,41 @@ template <typename Flavor> class SumcheckProverRound {
             Utils::zero_univariates(accum);
         }
 
-        // Construct extended edge containers; one per thread
+        // Construct tile, edge and extended edge containers; one per thread
+        std::vector<EdgeTile> edge_tiles(num_threads);
+        std::vector<EdgePairs> edges(num_threads);
         std::vector<ExtendedEdges> extended_edges;
         extended_edges.resize(num_threads);
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+            size_t start = std::min(active_start + (thread_idx * iterations_per_thread), active_end);
+            size_t end = std::min(start + iterations_per_thread, active_end);
+
+            for (size_t tile_start = start; tile_start < end; tile_start += 2 * EDGE_TILE_SIZE) {
+                const size_t tile_rows = std::min(2 * EDGE_TILE_SIZE, end - tile_start);
+                load_edge_tile(edge_tiles[thread_idx], polynomials, tile_start, tile_rows);
+
+                for (size_t row = 0; row < tile_rows; row += 2) {
+                    auto& edge = edges[thread_idx];
+                    load_tile_edge(edge, edge_tiles[thread_idx], row);
+                    // Rows on which every relation is inactive contribute nothing, so don't extend them
+                    if (all_relations_skippable(edge)) {
+                        continue;
+                    }
+                    extend_tile_edge(extended_edges[thread_idx], edge);
+                    const size_t edge_idx = tile_start + row;
+                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
+                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    edge,
+                                                    relation_parameters,
+                                                    gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
+                }
             }
         });
 
@@ -323,6 +411,7 @@ template <typename Flavor> class SumcheckProverRound {
      *accumulate_relation_univariates "accumulate relation univariates" for the previous "groups of edges".
      * @param extended_edges Contains tuples of evaluations of \f$ P_j\left(u_0,\ldots, u_{i-1}, k, \vec \ell \right)
      *\f$, for \f$ j=1,\ldots, N \f$,  \f$ k \in \{0,\ldots, D\} \f$ and fixed \f$\vec \ell \in \{0,1\}^{d-1 - i} \f$.
+     * @param edge The same evaluations for \f$ k \in \{0,1\} \f$ only, used to decide which relations can be skipped.
      * @param scaling_factor In Round \f$ i \f$, for \f$ (\ell_{i+1}, \ldots, \ell_{d-1}) \in \{0,1\}^{d-1-i}\f$ takes
      *an element of \ref  bb::GateSeparatorPolynomial< FF >::beta_products "vector of powers of challenges" at index \f$
      *2^{i+1}
@@ -333,18 +422,19 @@ template <typename Flavor> class SumcheckProverRound {
     template <size_t relation_idx = 0>
     void accumulate_relation_univariates(SumcheckTupleOfTuplesOfUnivariates& univariate_accumulators,
                                          const auto& extended_edges,
+                                         const EdgePairs& edge,
                                          const bb::RelationParameters<FF>& relation_parameters,
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
         // Check if the relation is skippable to speed up accumulation
-        if constexpr (!isSkippable<Relation, decltype(extended_edges)>) {
+        if constexpr (!isSkippable<Relation, EdgePairs>) {
             // If not, accumulate normally
             Relation::accumulate(
                 std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
         } else {
-            // If so, only compute the contribution if the relation is active
-            if (!Relation::skip(extended_edges)) {
+            // If so, only compute the contribution if the relation is active. This is decided on the unextended edge.
+            if (!Relation::skip(edge)) {
                 Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
                                      extended_edges,
                                      relation_parameters,
@@ -354,7 +444,61 @@ template <typename Flavor> class SumcheckProverRound {
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
             accumulate_relation_univariates<relation_idx + 1>(
-                univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
+                univariate_accumulators, extended_edges, edge, relation_parameters, scaling_factor);
+        }
+    }
+
+    /**
+     * @brief Get the range of rows \f$ [start, end) \f$ of the current round outside of which every polynomial is zero
+     * @details This is the hull of the memory-backed ranges of the polynomials, aligned to edges. Edges outside of it
+     * are zero in every polynomial, so provided that the relations skip an all-zero edge (checked here), they
+     * contribute nothing to the round univariate and need not be visited at all.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    std::pair<size_t, size_t> get_active_range(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials)
+    {
+        EdgePairs zero_edge;
+        for (auto& edge_pair : zero_edge.get_all()) {
+            edge_pair = bb::Univariate<FF, 2>::zero();
+        }
+        if (!all_relations_skippable(zero_edge)) {
+            return { 0, round_size };
+        }
+
+        size_t start = round_size;
+        size_t end = 0;
+        for (auto& polynomial : polynomials.get_all()) {
+            const size_t poly_end = std::min(polynomial.end_index(), round_size);
+            if (polynomial.start_index() < poly_end) {
+                start = std::min(start, polynomial.start_index());
+                end = std::max(end, poly_end);
+            }
+        }
+        if (start >= end) {
+            return { 0, 0 };
+        }
+        // Align to edges, i.e. pairs of rows (2i, 2i + 1)
+        return { start & ~static_cast<size_t>(1), std::min(end + (end & 1), round_size) };
+    }
+
+    /**
+     * @brief Whether every relation can be skipped on an edge, in which case the edge contributes nothing to the round
+     * univariate
+     */
+    template <size_t relation_idx = 0> static bool all_relations_skippable(const EdgePairs& edge)
+    {
+        using Relation = std::tuple_element_t<relation_idx, Relations>;
+        if constexpr (!isSkippable<Relation, EdgePairs>) {
+            return false;
+        } else {
+            if (!Relation::skip(edge)) {
+                return false;
+            }
+            if constexpr (relation_idx + 1 < NUM_RELATIONS) {
+                return all_relations_skippable<relation_idx + 1>(edge);
+            } else {
+                return true;
+            }
         }
     }
 };
@@ -131,3 +131,57 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that computing the round univariate tile by tile, skipping inactive edges, agrees with computing it one
+ * edge at a time
+ * @details With all gate challenges equal to 1 the round univariate is the sum of the round univariates of the
+ * individual edges. The polynomials are spread over several tiles and threads, and every third edge is inactive.
+ */
+TEST(SumcheckRound, ComputeUnivariateMatchesSumOverEdges)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+    using RelationSeparator = typename Flavor::RelationSeparator;
+    using SumcheckRoundUnivariate = typename SumcheckProverRound<Flavor>::SumcheckRoundUnivariate;
+
+    const size_t log_circuit_size = 9;
+    const size_t circuit_size = 1 << log_circuit_size;
+
+    ProverPolynomials polynomials;
+    for (auto& poly : polynomials.get_all()) {
+        poly = Polynomial<FF>::random(circuit_size);
+        for (size_t edge_idx = 0; edge_idx < circuit_size; edge_idx += 6) {
+            poly.at(edge_idx) = 0;
+            poly.at(edge_idx + 1) = 0;
+        }
+    }
+
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+
+    GateSeparatorPolynomial<FF> gate_separators(std::vector<FF>(log_circuit_size, 1), log_circuit_size);
+    SumcheckProverRound<Flavor> round(circuit_size);
+    auto result =
+        round.compute_univariate(0, polynomials, relation_parameters, gate_separators, alpha, ZKSumcheckData<Flavor>());
+
+    SumcheckRoundUnivariate expected(0);
+    GateSeparatorPolynomial<FF> edge_gate_separators(std::vector<FF>{ 1 }, 1);
+    for (size_t edge_idx = 0; edge_idx < circuit_size; edge_idx += 2) {
+        ProverPolynomials edge_polynomials;
+        for (auto [edge_poly, poly] : zip_view(edge_polynomials.get_all(), polynomials.get_all())) {
+            edge_poly = Polynomial<FF>(2);
+            edge_poly.at(0) = poly[edge_idx];
+            edge_poly.at(1) = poly[edge_idx + 1];
+        }
+        SumcheckProverRound<Flavor> edge_round(2);
+        expected += edge_round.compute_univariate(
+            0, edge_polynomials, relation_parameters, edge_gate_separators, alpha, ZKSumcheckData<Flavor>());
+    }
+
+    EXPECT_EQ(result, expected);
+}
@@ -3,6 +3,7 @@
 // #define LOG_INTERACTIONS
 
 #include "barretenberg/common/debug_log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -379,7 +380,9 @@ template <typename TranscriptParams> class BaseTranscript {
     template <class T> T receive_from_prover(const std::string& label)
     {
         const size_t element_size = TranscriptParams::template calc_num_bn254_frs<T>();
-        ASSERT(num_frs_read + element_size <= proof_data.size());
+        if (num_frs_read + element_size > proof_data.size()) {
+            throw_or_abort("Transcript: proof is too short to receive " + label);
+        }
 
         auto element_frs = std::span{ proof_data }.subspan(num_frs_read, element_size);
         num_frs_read += element_size;
@@ -8,10 +8,12 @@
  *
  */
 #include "translator_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/plonk/proof_system/constants.hpp"
 #include "barretenberg/stdlib_circuit_builders/op_queue/ecc_op_queue.hpp"
+#include <algorithm>
 #include <cstddef>
 namespace bb {
 using ECCVMOperation = ECCOpQueue::ECCVMOperation;
@@ -605,41 +607,62 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(std::shared_ptr<EC
 {
     using Fq = bb::fq;
     const auto& raw_ops = ecc_op_queue->get_raw_ops();
-    std::vector<Fq> accumulator_trace;
-    Fq current_accumulator(0);
     if (raw_ops.empty()) {
         return;
     }
+    const size_t num_ops = raw_ops.size();
     // Rename for ease of use
     auto x = evaluation_input_x;
     auto v = batching_challenge_v;
 
     // We need to precompute the accumulators at each step, because in the actual circuit we compute the values starting
-    // from the later indices. We need to know the previous accumulator to create the gate
-    for (size_t i = 0; i < raw_ops.size(); i++) {
-        const auto& ecc_op = raw_ops[raw_ops.size() - 1 - i];
-        current_accumulator *= x;
-        const auto [x_256, y_256] = ecc_op.get_base_point_standard_form();
-        current_accumulator +=
-            (Fq(ecc_op.get_opcode_value()) + v * (x_256 + v * (y_256 + v * (ecc_op.z1 + v * ecc_op.z2))));
-        accumulator_trace.push_back(current_accumulator);
+    // from the later indices. We need to know the previous accumulator to create the gate. The batched value of each op
+    // is independent of the others, so only the Horner chain over them is computed sequentially
+    std::vector<Fq> accumulator_trace(num_ops);
+    parallel_for_heuristic(
+        num_ops,
+        [&](size_t i) {
+            const auto& ecc_op = raw_ops[num_ops - 1 - i];
+            const auto [x_256, y_256] = ecc_op.get_base_point_standard_form();
+            accumulator_trace[i] =
+                (Fq(ecc_op.get_opcode_value()) + v * (x_256 + v * (y_256 + v * (ecc_op.z1 + v * ecc_op.z2))));
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 8);
+    Fq current_accumulator(0);
+    for (auto& accumulator : accumulator_trace) {
+        current_accumulator = current_accumulator * x + accumulator;
+        accumulator = current_accumulator;
     }
 
-    // We don't care about the last value since we'll recompute it during witness generation anyway
-    accumulator_trace.pop_back();
+    // The previous accumulator of the op at index i is accumulator_trace[num_ops - 2 - i], and zero for the last op (we
+    // don't care about the last value of the trace since we'll recompute it during witness generation anyway)
+    auto previous_accumulator = [&](size_t op_idx) {
+        return op_idx + 1 < num_ops ? accumulator_trace[num_ops - 2 - op_idx] : Fq(0);
+    };
+
+    // Each op adds two rows to every wire
+    for (auto& wire : wires) {
+        wire.reserve(wire.size() + 2 * num_ops);
+    }
 
-    for (const auto& raw_op : raw_ops) {
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
+    // The limb decompositions of different ops don't depend on each other, so we compute them in parallel, a chunk of
+    // ops at a time to bound the memory taken by the intermediate AccumulationInputs. Variable indices are handed out by
+    // add_variable, so the gates themselves are then created sequentially in the order of the ops
+    constexpr size_t WITNESS_CHUNK_SIZE = 1UL << 10;
+    std::vector<AccumulationInput> accumulation_steps(std::min(num_ops, WITNESS_CHUNK_SIZE));
+    for (size_t chunk_start = 0; chunk_start < num_ops; chunk_start += WITNESS_CHUNK_SIZE) {
+        const size_t chunk_size = std::min(WITNESS_CHUNK_SIZE, num_ops - chunk_start);
+        parallel_for_heuristic(
+            chunk_size,
+            [&](size_t i) {
+                const size_t op_idx = chunk_start + i;
+                accumulation_steps[i] =
+                    compute_witness_values_for_one_ecc_op(raw_ops[op_idx], previous_accumulator(op_idx), v, x);
+            },
+            thread_heuristics::ALWAYS_MULTITHREAD);
+        for (size_t i = 0; i < chunk_size; i++) {
+            create_accumulation_gate(accumulation_steps[i]);
         }
-        // Compute witness values
-        auto one_accumulation_step = compute_witness_values_for_one_ecc_op(raw_op, previous_accumulator, v, x);
-
-        // And put them into the wires
-        create_accumulation_gate(one_accumulation_step);
     }
 }
 bool TranslatorCircuitBuilder::check_circuit()
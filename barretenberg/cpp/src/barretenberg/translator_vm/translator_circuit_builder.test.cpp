@@ -128,4 +128,47 @@ TEST(TranslatorCircuitBuilder, SeveralOperationCorrectness)
     EXPECT_TRUE(circuit_builder.check_circuit());
     // Check the computation result is in line with what we've computed
     EXPECT_EQ(result, circuit_builder.get_computation_result());
-}
\ No newline at end of file
+}
+/**
+ * @brief Check that an op queue longer than the chunk of ops whose witnesses are computed in parallel produces a correct
+ * circuit
+ *
+ */
+TEST(TranslatorCircuitBuilder, ManyOperationsCorrectness)
+{
+    using point = g1::affine_element;
+    using scalar = fr;
+    using Fq = fq;
+
+    auto P1 = point::random_element();
+    auto P2 = point::random_element();
+    auto z = scalar::random_element();
+
+    auto op_queue = std::make_shared<ECCOpQueue>();
+    const size_t num_iterations = 700;
+    for (size_t i = 0; i < num_iterations; i++) {
+        op_queue->add_accumulate(P1);
+        op_queue->mul_accumulate(P2, z);
+        op_queue->eq_and_reset();
+    }
+
+    Fq batching_challenge = Fq::random_element();
+    Fq x = Fq::random_element();
+
+    // Compute the batched evaluation, starting from the last op
+    const auto& raw_ops = op_queue->get_raw_ops();
+    Fq result = 0;
+    for (auto it = raw_ops.rbegin(); it != raw_ops.rend(); ++it) {
+        const auto [x_u256, y_u256] = it->get_base_point_standard_form();
+        result = result * x + (Fq(it->get_opcode_value()) +
+                               batching_challenge *
+                                   (x_u256 + batching_challenge *
+                                                 (y_u256 + batching_challenge *
+                                                               (it->z1 + batching_challenge * it->z2))));
+    }
+
+    auto circuit_builder = TranslatorCircuitBuilder(batching_challenge, x, op_queue);
+    EXPECT_EQ(circuit_builder.num_gates, 1 + 2 * raw_ops.size());
+    EXPECT_TRUE(circuit_builder.check_circuit());
+    EXPECT_EQ(result, circuit_builder.get_computation_result());
+}
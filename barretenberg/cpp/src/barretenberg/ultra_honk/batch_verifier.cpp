@@ -0,0 +1,91 @@
+#include "batch_verifier.hpp"
+#include "barretenberg/commitment_schemes/claim.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <optional>
+
+namespace bb {
+
+template <typename Flavor>
+bool BatchVerifier_<Flavor>::verify(const std::vector<std::shared_ptr<VerificationKey>>& verification_keys,
+                                    const std::vector<HonkProof>& proofs)
+{
+    using Curve = typename Flavor::Curve;
+    using GroupElement = typename Flavor::GroupElement;
+
+    if (verification_keys.size() != proofs.size()) {
+        throw_or_abort("BatchVerifier: the number of verification keys and proofs must match");
+    }
+    const size_t num_proofs = proofs.size();
+    if (num_proofs == 0) {
+        return true;
+    }
+
+    // Everything but the pairing is independent per proof
+    std::vector<std::optional<BatchOpeningClaim<Curve>>> claims(num_proofs);
+    parallel_for(num_proofs, [&](size_t i) {
+        UltraVerifier_<Flavor> verifier{ verification_keys[i] };
+#ifndef __wasm__
+        // A malformed proof is rejected like any other invalid one rather than throwing out of a worker
+        try {
+            claims[i] = verifier.reduce_to_pairing_claim(proofs[i]);
+        } catch (const std::exception&) {
+            claims[i] = std::nullopt;
+        }
+#else
+        claims[i] = verifier.reduce_to_pairing_claim(proofs[i]);
+#endif
+    });
+
+    // Terms of P₀ = ∑ rᵢ⋅P₀ᵢ and P₁ = ∑ rᵢ⋅P₁ᵢ. As in batch_mul_native, points at infinity (and points with y = 0, due
+    // to their serialization) and zero scalars are skipped
+    std::vector<Commitment> p0_points;
+    std::vector<FF> p0_scalars;
+    std::vector<Commitment> p1_points;
+    std::vector<FF> p1_scalars;
+    const auto add_term = [](auto& points, auto& scalars, const Commitment& point, const FF& scalar) {
+        if (!scalar.is_zero() && !point.is_point_at_infinity() && !point.y.is_zero()) {
+            points.emplace_back(point);
+            scalars.emplace_back(scalar);
+        }
+    };
+    for (size_t i = 0; i < num_proofs; i++) {
+        if (!claims[i]) {
+            return false;
+        }
+        const auto& claim = *claims[i];
+        // The first claim needs no randomness: it is enough that the others are randomized relative to it
+        const FF r = i == 0 ? FF::one() : FF::random_element();
+        for (size_t j = 0; j < claim.commitments.size(); j++) {
+            add_term(p0_points, p0_scalars, claim.commitments[j], r * claim.scalars[j]);
+        }
+        // P₁ᵢ = -[W]₁, the last commitment of the claim
+        add_term(p1_points, p1_scalars, claim.commitments.back(), -r);
+    }
+
+    // The same commitments (e.g. selectors of a repeated circuit) may appear several times, so edge cases must be
+    // handled
+    const auto msm = [](std::vector<Commitment>& points, std::vector<FF>& scalars) {
+        if (points.empty()) {
+            return GroupElement::infinity();
+        }
+        std::vector<Commitment> point_table(points.size() * 2);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), point_table.data(), points.size());
+        scalar_multiplication::pippenger_runtime_state<Curve> state(points.size());
+        return scalar_multiplication::pippenger<Curve>({ 0, scalars }, point_table, state, /*handle_edge_cases=*/true);
+    };
+    const GroupElement P_0 = msm(p0_points, p0_scalars);
+    const GroupElement P_1 = msm(p1_points, p1_scalars);
+
+    return verification_keys[0]->pcs_verification_key->pairing_check(P_0, P_1);
+}
+
+template class BatchVerifier_<UltraFlavor>;
+template class BatchVerifier_<UltraKeccakFlavor>;
+template class BatchVerifier_<MegaFlavor>;
+template class BatchVerifier_<MegaZKFlavor>;
+
+} // namespace bb
@@ -0,0 +1,42 @@
+#pragma once
+#include "barretenberg/honk/proof_system/types/proof.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Verifies many Honk proofs with a single pairing
+ * @details Each proof is reduced by UltraVerifier_::reduce_to_pairing_claim to pairing points (P₀ᵢ, P₁ᵢ) such that the
+ * proof is valid iff e(P₀ᵢ, [1]₂)⋅e(P₁ᵢ, [x]₂) = 1. The reductions are independent and run in parallel. The claims
+ * are then folded with random rᵢ into a single pair P₀ = ∑ rᵢ⋅P₀ᵢ, P₁ = ∑ rᵢ⋅P₁ᵢ, each computed as one MSM over the
+ * commitments of all proofs, so that the batch costs one pairing (one Miller loop over two points and one final
+ * exponentiation) instead of one per proof. If any proof is invalid, the folded check passes with probability ~1/|Fr|.
+ *
+ * The proofs may be for different circuits but must share the verifier SRS.
+ */
+template <typename Flavor> class BatchVerifier_ {
+    using FF = typename Flavor::FF;
+    using Commitment = typename Flavor::Commitment;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+  public:
+    /**
+     * @brief Verify proofs[i] against verification_keys[i] for every i
+     * @return true iff every proof verifies (an empty batch is trivially valid)
+     */
+    static bool verify(const std::vector<std::shared_ptr<VerificationKey>>& verification_keys,
+                       const std::vector<HonkProof>& proofs);
+};
+
+using UltraBatchVerifier = BatchVerifier_<UltraFlavor>;
+using UltraKeccakBatchVerifier = BatchVerifier_<UltraKeccakFlavor>;
+using MegaBatchVerifier = BatchVerifier_<MegaFlavor>;
+using MegaZKBatchVerifier = BatchVerifier_<MegaZKFlavor>;
+
+} // namespace bb
@@ -72,12 +72,6 @@ void DeciderProvingKey_<Flavor>::construct_databus_polynomials(Circuit& circuit)
         return_data_read_counts.at(idx) = return_data.get_read_count(idx);        // read counts
         return_data_read_tags.at(idx) = return_data_read_counts[idx] > 0 ? 1 : 0; // has row been read or not
     }
-
-    auto& databus_id = proving_key.polynomials.databus_id;
-    // Compute a simple identity polynomial for use in the databus lookup argument
-    for (size_t i = 0; i < databus_id.size(); ++i) {
-        databus_id.at(i) = i;
-    }
 }
 
 /**
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/execution_trace/execution_trace.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/plonk_honk_shared/arithmetization/mega_arithmetization.hpp"
@@ -9,6 +10,7 @@
 #include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include "barretenberg/ultra_honk/precomputed_proving_key.hpp"
 
 namespace bb {
 /**
@@ -18,6 +20,10 @@ namespace bb {
  * challenges set to non-zero values).
  *
  * @details This is the equivalent of ω in the paper.
+ *
+ * If a PrecomputedProvingKey_ for the circuit is provided (e.g. read from a proving key file written by bb
+ * write_pk_ultra_honk), its precomputed polynomials are shared into the proving key and only the witness polynomials
+ * are constructed from the circuit.
  */
 
 template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
@@ -29,6 +35,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
     using ProverPolynomials = typename Flavor::ProverPolynomials;
     using Polynomial = typename Flavor::Polynomial;
     using RelationSeparator = typename Flavor::RelationSeparator;
+    using PrecomputedProvingKey = PrecomputedProvingKey_<Flavor>;
 
     using Trace = ExecutionTrace_<Flavor>;
 
@@ -47,7 +54,8 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = TraceSettings{},
-                       std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr)
+                       std::shared_ptr<typename Flavor::CommitmentKey> commitment_key = nullptr,
+                       std::shared_ptr<PrecomputedProvingKey> precomputed = nullptr)
         : is_structured(trace_settings.structure != TraceStructure::NONE)
     {
         PROFILE_THIS_NAME("DeciderProvingKey(Circuit&)");
@@ -86,11 +94,35 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
             PROFILE_THIS_NAME("constructing proving key");
 
             proving_key = ProvingKey(dyadic_circuit_size, circuit.public_inputs.size(), commitment_key);
+            if (precomputed) {
+                if (precomputed->circuit_size != dyadic_circuit_size ||
+                    precomputed->num_public_inputs != circuit.public_inputs.size() ||
+                    precomputed->circuit_fingerprint != PrecomputedProvingKey::compute_circuit_fingerprint(circuit)) {
+                    throw_or_abort("DeciderProvingKey: the precomputed proving key is for a different circuit");
+                }
+                for (auto [polynomial, precomputed_polynomial] :
+                     zip_view(proving_key.polynomials.get_precomputed(), precomputed->polynomials.get_all())) {
+                    polynomial = precomputed_polynomial.share();
+                }
+            }
             // If not using structured trace OR if using structured trace but overflow has occurred (overflow block in
             // use), allocate full size polys
             if ((IsGoblinFlavor<Flavor> && !is_structured) || (is_structured && circuit.blocks.has_overflow)) {
                 // Allocate full size polynomials
-                proving_key.polynomials = typename Flavor::ProverPolynomials(dyadic_circuit_size);
+                if (precomputed) { // only those not already taken from the precomputed key
+                    for (auto& polynomial : proving_key.polynomials.get_to_be_shifted()) {
+                        if (polynomial.is_empty()) {
+                            polynomial = Polynomial::shiftable(dyadic_circuit_size);
+                        }
+                    }
+                    for (auto& polynomial : proving_key.polynomials.get_unshifted()) {
+                        if (polynomial.is_empty()) {
+                            polynomial = Polynomial(dyadic_circuit_size);
+                        }
+                    }
+                } else {
+                    proving_key.polynomials = typename Flavor::ProverPolynomials(dyadic_circuit_size);
+                }
             } else { // Allocate only a correct amount of memory for each polynomial
                 // Allocate the wires and selectors polynomials
                 {
@@ -100,7 +132,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                         wire = Polynomial::shiftable(proving_key.circuit_size);
                     }
                 }
-                {
+                if (!precomputed) {
                     PROFILE_THIS_NAME("allocating gate selectors");
 
                     // Define gate selectors over the block they are isolated to
@@ -121,7 +153,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                         }
                     }
                 }
-                {
+                if (!precomputed) {
                     PROFILE_THIS_NAME("allocating non-gate selectors");
 
                     // Set the other non-gate selector polynomials to full size
@@ -138,8 +170,10 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                     for (auto& wire : proving_key.polynomials.get_ecc_op_wires()) {
                         wire = Polynomial(ecc_op_block_size, proving_key.circuit_size, op_wire_offset);
                     }
-                    proving_key.polynomials.lagrange_ecc_op =
-                        Polynomial(ecc_op_block_size, proving_key.circuit_size, op_wire_offset);
+                    if (!precomputed) {
+                        proving_key.polynomials.lagrange_ecc_op =
+                            Polynomial(ecc_op_block_size, proving_key.circuit_size, op_wire_offset);
+                    }
                 }
 
                 if constexpr (HasDataBus<Flavor>) {
@@ -162,12 +196,15 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                     // databus_size leads to failure.
                     // const size_t databus_size = std::max({ calldata.size(), secondary_calldata.size(),
                     // return_data.size() });
-                    proving_key.polynomials.databus_id = Polynomial(proving_key.circuit_size, proving_key.circuit_size);
+                    if (!precomputed) {
+                        proving_key.polynomials.databus_id =
+                            Polynomial(proving_key.circuit_size, proving_key.circuit_size);
+                    }
                 }
                 const size_t max_tables_size =
                     std::min(static_cast<size_t>(MAX_LOOKUP_TABLES_SIZE), dyadic_circuit_size - 1);
                 size_t table_offset = dyadic_circuit_size - max_tables_size;
-                {
+                if (!precomputed) {
                     PROFILE_THIS_NAME("allocating table polynomials");
 
                     ASSERT(dyadic_circuit_size > max_tables_size);
@@ -179,7 +216,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                         }
                     }
                 }
-                {
+                if (!precomputed) {
                     PROFILE_THIS_NAME("allocating sigmas and ids");
 
                     for (auto& sigma : proving_key.polynomials.get_sigmas()) {
@@ -234,7 +271,7 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                     vinfo("done constructing z_perm.");
                 }
 
-                {
+                if (!precomputed) {
                     PROFILE_THIS_NAME("allocating lagrange polynomials");
 
                     // First and last lagrange polynomials (in the full circuit size)
@@ -249,8 +286,11 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
 
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         vinfo("populating trace...");
-        Trace::populate(circuit, proving_key, is_structured);
+        Trace::populate(circuit, proving_key, is_structured, /*populate_precomputed=*/!precomputed);
         vinfo("done populating trace.");
+        if (precomputed && precomputed->pub_inputs_offset != proving_key.pub_inputs_offset) {
+            throw_or_abort("DeciderProvingKey: the precomputed proving key is for a different circuit");
+        }
 
         {
             PROFILE_THIS_NAME("constructing prover instance after trace populate");
@@ -262,15 +302,26 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
                 construct_databus_polynomials(circuit);
             }
         }
-        // Set the lagrange polynomials
-        proving_key.polynomials.lagrange_first.at(0) = 1;
-        proving_key.polynomials.lagrange_last.at(dyadic_circuit_size - 1) = 1;
+        // The remaining polynomials do not depend on the witness, so they come with the precomputed key if there is one
+        if (!precomputed) {
+            // Set the lagrange polynomials
+            proving_key.polynomials.lagrange_first.at(0) = 1;
+            proving_key.polynomials.lagrange_last.at(dyadic_circuit_size - 1) = 1;
+
+            if constexpr (HasDataBus<Flavor>) {
+                // Compute a simple identity polynomial for use in the databus lookup argument
+                auto& databus_id = proving_key.polynomials.databus_id;
+                for (size_t i = 0; i < databus_id.size(); ++i) {
+                    databus_id.at(i) = i;
+                }
+            }
 
-        {
-            PROFILE_THIS_NAME("constructing lookup table polynomials");
+            {
+                PROFILE_THIS_NAME("constructing lookup table polynomials");
 
-            construct_lookup_table_polynomials<Flavor>(
-                proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
+                construct_lookup_table_polynomials<Flavor>(
+                    proving_key.polynomials.get_tables(), circuit, dyadic_circuit_size);
+            }
         }
 
         {
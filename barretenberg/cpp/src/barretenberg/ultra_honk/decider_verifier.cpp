@@ -37,7 +37,34 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify_proof(const Dec
 template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
 {
     using PCS = typename Flavor::PCS;
-    using Curve = typename Flavor::Curve;
+
+    const auto opening_claim = compute_batch_opening_claim();
+    if (!opening_claim) {
+        return false;
+    }
+    const auto pairing_points = PCS::reduce_verify_batch_opening_claim(*opening_claim, transcript);
+    return pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
+}
+
+template <typename Flavor>
+std::optional<BatchOpeningClaim<typename Flavor::Curve>> DeciderVerifier_<Flavor>::reduce_to_pairing_claim()
+{
+    using PCS = typename Flavor::PCS;
+
+    const auto opening_claim = compute_batch_opening_claim();
+    if (!opening_claim) {
+        return std::nullopt;
+    }
+    return PCS::append_quotient_commitment(*opening_claim, transcript);
+}
+
+/**
+ * @brief Run the sumcheck and Shplemini verifiers on the proof in the transcript
+ * @return The batch opening claim to be checked by the PCS, or std::nullopt if sumcheck failed
+ */
+template <typename Flavor>
+std::optional<BatchOpeningClaim<typename Flavor::Curve>> DeciderVerifier_<Flavor>::compute_batch_opening_claim()
+{
     using Shplemini = ShpleminiVerifier_<Curve>;
     using VerifierCommitments = typename Flavor::VerifierCommitments;
 
@@ -65,26 +92,21 @@ template <typename Flavor> bool DeciderVerifier_<Flavor>::verify()
     }
 
     // If Sumcheck did not verify, return false
-    if (sumcheck_output.verified.has_value() && !sumcheck_output.verified.value()) {
+    if (!sumcheck_output.verified.value_or(false)) {
         info("Sumcheck verification failed.");
-        return false;
+        return std::nullopt;
     }
 
-    const BatchOpeningClaim<Curve> opening_claim =
-        Shplemini::compute_batch_opening_claim(accumulator->verification_key->circuit_size,
-                                               commitments.get_unshifted(),
-                                               commitments.get_to_be_shifted(),
-                                               sumcheck_output.claimed_evaluations.get_unshifted(),
-                                               sumcheck_output.claimed_evaluations.get_shifted(),
-                                               sumcheck_output.challenge,
-                                               Commitment::one(),
-                                               transcript,
-                                               RefVector(libra_commitments),
-                                               libra_evaluations);
-    const auto pairing_points = PCS::reduce_verify_batch_opening_claim(opening_claim, transcript);
-    bool verified = pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-
-    return sumcheck_output.verified.value() && verified;
+    return Shplemini::compute_batch_opening_claim(accumulator->verification_key->circuit_size,
+                                                  commitments.get_unshifted(),
+                                                  commitments.get_to_be_shifted(),
+                                                  sumcheck_output.claimed_evaluations.get_unshifted(),
+                                                  sumcheck_output.claimed_evaluations.get_shifted(),
+                                                  sumcheck_output.challenge,
+                                                  Commitment::one(),
+                                                  transcript,
+                                                  RefVector(libra_commitments),
+                                                  libra_evaluations);
 }
 
 template class DeciderVerifier_<UltraFlavor>;
@@ -1,4 +1,5 @@
 #pragma once
+#include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
@@ -6,9 +7,12 @@
 #include "barretenberg/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/ultra_honk/decider_verification_key.hpp"
 
+#include <optional>
+
 namespace bb {
 template <typename Flavor> class DeciderVerifier_ {
     using FF = typename Flavor::FF;
+    using Curve = typename Flavor::Curve;
     using Commitment = typename Flavor::Commitment;
     using VerificationKey = typename Flavor::VerificationKey;
     using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
@@ -31,11 +35,22 @@ template <typename Flavor> class DeciderVerifier_ {
 
     bool verify_proof(const DeciderProof&); // used when a decider proof is known explicitly
     bool verify();                          // used when transcript that has been initialized with a proof
+
+    /**
+     * @brief Run the sumcheck and Shplemini verifiers on the proof in the transcript, and receive the KZG quotient
+     * @return A claim whose MSM is the pairing point P₀ and whose last commitment is −P₁ (see
+     * KZG::append_quotient_commitment), or std::nullopt if sumcheck failed
+     */
+    std::optional<BatchOpeningClaim<Curve>> reduce_to_pairing_claim();
+
     std::shared_ptr<VerificationKey> key;
     std::map<std::string, Commitment> commitments;
     std::shared_ptr<DeciderVerificationKey> accumulator;
     std::shared_ptr<VerifierCommitmentKey> pcs_verification_key;
     std::shared_ptr<Transcript> transcript;
+
+  private:
+    std::optional<BatchOpeningClaim<Curve>> compute_batch_opening_claim();
 };
 
 using UltraDeciderVerifier = DeciderVerifier_<UltraFlavor>;
@@ -94,23 +94,23 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     PROFILE_THIS_NAME("OinkProver::execute_wire_commitments_round");
     // Commit to the first three wire polynomials
     // We only commit to the fourth wire polynomial after adding memory recordss
+    auto& polynomials = proving_key->proving_key.polynomials;
+    auto& commitment_key = proving_key->proving_key.commitment_key;
     {
         PROFILE_THIS_NAME("COMMIT::wires");
+        auto wires = RefArray{ polynomials.w_l, polynomials.w_r, polynomials.w_o };
+        std::vector<typename Flavor::Commitment> commitments;
         if (proving_key->get_is_structured()) {
-            witness_commitments.w_l = proving_key->proving_key.commitment_key->commit_structured(
-                proving_key->proving_key.polynomials.w_l, proving_key->proving_key.active_block_ranges);
-            witness_commitments.w_r = proving_key->proving_key.commitment_key->commit_structured(
-                proving_key->proving_key.polynomials.w_r, proving_key->proving_key.active_block_ranges);
-            witness_commitments.w_o = proving_key->proving_key.commitment_key->commit_structured(
-                proving_key->proving_key.polynomials.w_o, proving_key->proving_key.active_block_ranges);
+            commitments =
+                commitment_key->batch_commit_structured(wires, proving_key->proving_key.active_block_ranges);
         } else {
-            witness_commitments.w_l =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_l);
-            witness_commitments.w_r =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_r);
-            witness_commitments.w_o =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_o);
+            for (auto& wire : wires) {
+                commitments.emplace_back(commitment_key->commit(wire));
+            }
         }
+        witness_commitments.w_l = commitments[0];
+        witness_commitments.w_r = commitments[1];
+        witness_commitments.w_o = commitments[2];
     }
 
     auto wire_comms = witness_commitments.get_wires();
@@ -123,23 +123,22 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 
         // Commit to Goblin ECC op wires
         for (auto [commitment, polynomial, label] : zip_view(witness_commitments.get_ecc_op_wires(),
-                                                             proving_key->proving_key.polynomials.get_ecc_op_wires(),
+                                                             polynomials.get_ecc_op_wires(),
                                                              commitment_labels.get_ecc_op_wires())) {
             {
                 PROFILE_THIS_NAME("COMMIT::ecc_op_wires");
-                commitment = proving_key->proving_key.commitment_key->commit(polynomial);
+                commitment = commitment_key->commit(polynomial);
             }
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
 
         // Commit to DataBus related polynomials
-        for (auto [commitment, polynomial, label] :
-             zip_view(witness_commitments.get_databus_entities(),
-                      proving_key->proving_key.polynomials.get_databus_entities(),
-                      commitment_labels.get_databus_entities())) {
+        for (auto [commitment, polynomial, label] : zip_view(witness_commitments.get_databus_entities(),
+                                                             polynomials.get_databus_entities(),
+                                                             commitment_labels.get_databus_entities())) {
             {
                 PROFILE_THIS_NAME("COMMIT::databus");
-                commitment = proving_key->proving_key.commitment_key->commit(polynomial);
+                commitment = commitment_key->commit(polynomial);
             }
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
@@ -163,21 +162,31 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
     proving_key->proving_key.add_ram_rom_memory_records_to_wire_4(eta, eta_two, eta_three);
 
     // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
-    {
-        PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
-        witness_commitments.lookup_read_counts =
-            proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_counts);
-        witness_commitments.lookup_read_tags =
-            proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_tags);
-    }
-    {
-        PROFILE_THIS_NAME("COMMIT::wires");
-        if (proving_key->get_is_structured()) {
-            witness_commitments.w_4 = proving_key->proving_key.commitment_key->commit_structured(
-                proving_key->proving_key.polynomials.w_4, proving_key->proving_key.active_block_ranges);
-        } else {
+    auto& polynomials = proving_key->proving_key.polynomials;
+    auto& commitment_key = proving_key->proving_key.commitment_key;
+    if (proving_key->get_is_structured()) {
+        {
+            PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
+            // Read counts and tags are small values, committed to without a full MSM
+            auto commitments = commitment_key->batch_commit_sparse(
+                RefArray{ polynomials.lookup_read_counts, polynomials.lookup_read_tags });
+            witness_commitments.lookup_read_counts = commitments[0];
+            witness_commitments.lookup_read_tags = commitments[1];
+        }
+        {
+            PROFILE_THIS_NAME("COMMIT::wires");
             witness_commitments.w_4 =
-                proving_key->proving_key.commitment_key->commit(proving_key->proving_key.polynomials.w_4);
+                commitment_key->commit_structured(polynomials.w_4, proving_key->proving_key.active_block_ranges);
+        }
+    } else {
+        {
+            PROFILE_THIS_NAME("COMMIT::lookup_counts_tags");
+            witness_commitments.lookup_read_counts = commitment_key->commit(polynomials.lookup_read_counts);
+            witness_commitments.lookup_read_tags = commitment_key->commit(polynomials.lookup_read_tags);
+        }
+        {
+            PROFILE_THIS_NAME("COMMIT::wires");
+            witness_commitments.w_4 = commitment_key->commit(polynomials.w_4);
         }
     }
 
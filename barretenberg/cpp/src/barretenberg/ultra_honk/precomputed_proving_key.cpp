@@ -0,0 +1,248 @@
+#include "precomputed_proving_key.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_zk_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_keccak_flavor.hpp"
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <vector>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+namespace {
+
+// The proving key file is mmap'ed, so reading and writing it is not available in wasm
+#ifndef __wasm__
+template <typename Flavor> constexpr const char* flavor_name()
+{
+    if constexpr (std::same_as<Flavor, UltraFlavor>) {
+        return "Ultra";
+    } else if constexpr (std::same_as<Flavor, UltraKeccakFlavor>) {
+        return "UltraKeccak";
+    } else if constexpr (std::same_as<Flavor, MegaFlavor>) {
+        return "Mega";
+    } else {
+        return "MegaZK";
+    }
+}
+
+template <typename Flavor> bool is_valid_header(ProvingKeyFileHeader const& header)
+{
+    return header.magic == ProvingKeyFileHeader::MAGIC && header.version == ProvingKeyFileHeader::VERSION &&
+           header.element_size == sizeof(typename Flavor::FF) &&
+           std::strncmp(header.flavor_name, flavor_name<Flavor>(), sizeof(header.flavor_name)) == 0 &&
+           header.num_polynomials == Flavor::NUM_PRECOMPUTED_ENTITIES;
+}
+
+size_t round_up_to_alignment(size_t offset)
+{
+    return (offset + PROVING_KEY_DATA_ALIGNMENT - 1) / PROVING_KEY_DATA_ALIGNMENT * PROVING_KEY_DATA_ALIGNMENT;
+}
+#endif
+
+/**
+ * @brief Fold a value into a running hash, using the splitmix64 finalizer
+ */
+uint64_t hash_combine(uint64_t hash, uint64_t value)
+{
+    uint64_t x = hash + 0x9e3779b97f4a7c15ULL + value;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+} // namespace
+
+#ifndef __wasm__
+template <IsHonkFlavor Flavor>
+void PrecomputedProvingKey_<Flavor>::write(std::string const& path,
+                                           ProvingKey& proving_key,
+                                           CircuitBuilder& circuit,
+                                           const uint256_t& vk_hash)
+{
+    PROFILE_THIS_NAME("PrecomputedProvingKey::write");
+
+    ProvingKeyFileHeader header{};
+    header.magic = ProvingKeyFileHeader::MAGIC;
+    header.version = ProvingKeyFileHeader::VERSION;
+    header.element_size = sizeof(FF);
+    std::strncpy(header.flavor_name, flavor_name<Flavor>(), sizeof(header.flavor_name) - 1);
+    header.circuit_size = proving_key.circuit_size;
+    header.num_public_inputs = proving_key.num_public_inputs;
+    header.pub_inputs_offset = proving_key.pub_inputs_offset;
+    header.num_polynomials = Flavor::NUM_PRECOMPUTED_ENTITIES;
+    header.circuit_fingerprint = compute_circuit_fingerprint(circuit);
+    header.vk_hash = vk_hash;
+
+    // Lay the polynomials out one after the other, each at an aligned offset
+    auto precomputed = proving_key.polynomials.get_precomputed();
+    std::vector<PrecomputedPolynomialHeader> entries;
+    size_t offset = round_up_to_alignment(sizeof(header) + precomputed.size() * sizeof(PrecomputedPolynomialHeader));
+    for (auto& polynomial : precomputed) {
+        entries.push_back({ polynomial.start_index(), polynomial.size(), polynomial.virtual_size(), offset });
+        offset = round_up_to_alignment(offset + polynomial.size() * sizeof(FF));
+    }
+
+    // Write-then-rename so that concurrent provers only ever map complete files.
+    const std::string tmp_path = path + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(tmp_path, std::ios::binary);
+        if (!file) {
+            throw_or_abort("Failed to open proving key for writing: " + tmp_path);
+        }
+        const std::vector<char> padding(PROVING_KEY_DATA_ALIGNMENT, 0);
+        const auto pad_to = [&](size_t target) {
+            const auto position = static_cast<size_t>(file.tellp());
+            file.write(padding.data(), static_cast<std::streamsize>(target - position));
+        };
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   static_cast<std::streamsize>(entries.size() * sizeof(PrecomputedPolynomialHeader)));
+        for (auto [polynomial, entry] : zip_view(precomputed, entries)) {
+            pad_to(entry.data_offset);
+            file.write(reinterpret_cast<const char*>(polynomial.data()),
+                       static_cast<std::streamsize>(polynomial.size() * sizeof(FF)));
+        }
+        pad_to(offset);
+        if (!file) {
+            throw_or_abort("Failed to write proving key: " + tmp_path);
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        throw_or_abort("Failed to move proving key into place: " + path);
+    }
+}
+
+template <IsHonkFlavor Flavor>
+std::shared_ptr<PrecomputedProvingKey_<Flavor>> PrecomputedProvingKey_<Flavor>::read(std::string const& path)
+{
+    PROFILE_THIS_NAME("PrecomputedProvingKey::read");
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Failed to open proving key: " + path);
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) < sizeof(ProvingKeyFileHeader)) {
+        close(fd);
+        throw_or_abort("Not a valid proving key: " + path);
+    }
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+
+    // Writable but private: the prover never modifies the precomputed polynomials, but should it do so the pages are
+    // copied rather than written back to the key.
+    void* mapped = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        throw_or_abort("Failed to mmap proving key: " + path);
+    }
+    std::shared_ptr<uint8_t> mapping(static_cast<uint8_t*>(mapped),
+                                     [file_size](uint8_t* ptr) { munmap(ptr, file_size); });
+
+    ProvingKeyFileHeader header{};
+    std::memcpy(static_cast<void*>(&header), mapping.get(), sizeof(header));
+    const size_t entries_end = sizeof(header) + Flavor::NUM_PRECOMPUTED_ENTITIES * sizeof(PrecomputedPolynomialHeader);
+    if (!is_valid_header<Flavor>(header) || file_size < entries_end) {
+        throw_or_abort("Not a valid " + std::string(flavor_name<Flavor>()) + " proving key: " + path);
+    }
+
+    auto key = std::make_shared<PrecomputedProvingKey_>();
+    key->circuit_size = header.circuit_size;
+    key->num_public_inputs = header.num_public_inputs;
+    key->pub_inputs_offset = header.pub_inputs_offset;
+    key->circuit_fingerprint = header.circuit_fingerprint;
+    key->vk_hash = header.vk_hash;
+
+    size_t entry_offset = sizeof(header);
+    for (auto& polynomial : key->polynomials.get_all()) {
+        PrecomputedPolynomialHeader entry{};
+        std::memcpy(&entry, mapping.get() + entry_offset, sizeof(entry));
+        entry_offset += sizeof(entry);
+
+        // Guard against truncated or corrupted files, reading past the end of the mapping faults.
+        if (entry.data_offset % PROVING_KEY_DATA_ALIGNMENT != 0 || entry.data_offset < entries_end ||
+            entry.data_offset > file_size || entry.size > (file_size - entry.data_offset) / sizeof(FF) ||
+            entry.start_index + entry.size > entry.virtual_size) {
+            throw_or_abort("Corrupted proving key: " + path);
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> coefficients(mapping, reinterpret_cast<FF*>(mapping.get() + entry.data_offset));
+        polynomial = Polynomial::from_backing_memory(
+            std::move(coefficients), entry.size, entry.virtual_size, entry.start_index);
+    }
+    return key;
+}
+#endif
+
+template <IsHonkFlavor Flavor>
+uint64_t PrecomputedProvingKey_<Flavor>::compute_circuit_fingerprint(CircuitBuilder& circuit)
+{
+    PROFILE_THIS_NAME("PrecomputedProvingKey::compute_circuit_fingerprint");
+
+    // Rows are hashed in fixed size chunks, in parallel, so that the result does not depend on the number of threads
+    constexpr size_t ROWS_PER_CHUNK = 1UL << 12;
+
+    uint64_t fingerprint = 0;
+    for (auto& block : circuit.blocks.get()) {
+        const size_t block_size = block.size();
+        const size_t num_chunks = (block_size + ROWS_PER_CHUNK - 1) / ROWS_PER_CHUNK;
+        std::vector<uint64_t> chunk_hashes(num_chunks);
+        parallel_for(num_chunks, [&](size_t chunk_idx) {
+            uint64_t hash = 0;
+            const size_t end = std::min(block_size, (chunk_idx + 1) * ROWS_PER_CHUNK);
+            for (size_t row_idx = chunk_idx * ROWS_PER_CHUNK; row_idx < end; ++row_idx) {
+                for (auto& wire : block.wires) {
+                    const uint32_t real_idx = circuit.real_variable_index[wire[row_idx]];
+                    hash = hash_combine(hash, real_idx);
+                    hash = hash_combine(hash, circuit.real_variable_tags[real_idx]);
+                }
+                for (auto& selector : block.selectors) {
+                    for (const uint64_t limb : selector[row_idx].data) {
+                        hash = hash_combine(hash, limb);
+                    }
+                }
+            }
+            chunk_hashes[chunk_idx] = hash;
+        });
+        fingerprint = hash_combine(fingerprint, block_size);
+        for (const uint64_t hash : chunk_hashes) {
+            fingerprint = hash_combine(fingerprint, hash);
+        }
+    }
+    // The tags of the wired variables are hashed above, their permutation determines the sigmas of tagged cycles
+    fingerprint = hash_combine(fingerprint, circuit.tau.size());
+    for (const uint32_t tag : circuit.tau) {
+        fingerprint = hash_combine(fingerprint, tag);
+    }
+    for (auto& table : circuit.lookup_tables) {
+        fingerprint = hash_combine(fingerprint, static_cast<uint64_t>(table.id));
+        fingerprint = hash_combine(fingerprint, table.table_index);
+        fingerprint = hash_combine(fingerprint, table.size());
+    }
+    for (auto& records : { std::cref(circuit.memory_read_records), std::cref(circuit.memory_write_records) }) {
+        fingerprint = hash_combine(fingerprint, records.get().size());
+        for (const uint32_t record : records.get()) {
+            fingerprint = hash_combine(fingerprint, record);
+        }
+    }
+    return fingerprint;
+}
+
+template class PrecomputedProvingKey_<UltraFlavor>;
+template class PrecomputedProvingKey_<UltraKeccakFlavor>;
+template class PrecomputedProvingKey_<MegaFlavor>;
+template class PrecomputedProvingKey_<MegaZKFlavor>;
+
+} // namespace bb
@@ -0,0 +1,107 @@
+#pragma once
+#include "barretenberg/flavor/flavor.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace bb {
+
+/**
+ * @brief Header of an on-disk Honk proving key
+ *
+ * @details The file holds the precomputed polynomials of a proving key (selectors, sigmas/ids, tables and Lagrange
+ * polynomials), i.e. everything which depends on the circuit but not on the witness, as raw in-memory (Montgomery
+ * form) field elements:
+ *
+ * 00000 | header (this struct)
+ * ..... | one PrecomputedPolynomialHeader per precomputed entity, in PrecomputedEntities::get_all() order
+ * ..... | zero padding up to PROVING_KEY_DATA_ALIGNMENT
+ * ..... | the memory-backed coefficients of each polynomial, each starting at a multiple of PROVING_KEY_DATA_ALIGNMENT
+ *
+ * The key is identified by the hash of the verification key of the circuit it was computed for, and carries a
+ * fingerprint of the circuit's structure against which the circuit being proven is checked. As with the point table
+ * cache, a file is only valid on a machine with the same endianness as the one that wrote it.
+ */
+struct ProvingKeyFileHeader {
+    static constexpr uint64_t MAGIC = 0x4b504b4e4f484242; // "BBHONKPK" read as a little endian uint64
+    static constexpr uint32_t VERSION = 3;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    char flavor_name[16];
+    uint64_t circuit_size;
+    uint64_t num_public_inputs;
+    uint64_t pub_inputs_offset;
+    uint64_t num_polynomials;
+    uint64_t circuit_fingerprint;
+    uint256_t vk_hash;
+};
+
+struct PrecomputedPolynomialHeader {
+    uint64_t start_index;
+    uint64_t size;
+    uint64_t virtual_size;
+    uint64_t data_offset; // from the start of the file
+};
+
+static constexpr size_t PROVING_KEY_DATA_ALIGNMENT = 64;
+
+/**
+ * @brief The precomputed half of a Honk proving key, read from or written to a proving key file
+ * @details A DeciderProvingKey_ constructed with one of these takes its precomputed polynomials from it and only builds
+ * the witness polynomials from the circuit, skipping the selectors, the permutation (copy cycles and sigma/id
+ * polynomials) and the lookup tables.
+ *
+ * When read, the file is mmap'ed copy-on-write, and the polynomials point straight into the mapping. Nothing is parsed
+ * or copied, and all processes proving the same circuit share a single copy of the key in the page cache. Reading and
+ * writing key files is not available in wasm.
+ */
+template <IsHonkFlavor Flavor> class PrecomputedProvingKey_ {
+    using FF = typename Flavor::FF;
+    using Polynomial = typename Flavor::Polynomial;
+    using ProvingKey = typename Flavor::ProvingKey;
+    using CircuitBuilder = typename Flavor::CircuitBuilder;
+
+  public:
+    using PrecomputedPolynomials = typename Flavor::template PrecomputedEntities<Polynomial>;
+
+    size_t circuit_size = 0;
+    size_t num_public_inputs = 0;
+    size_t pub_inputs_offset = 0;
+    uint64_t circuit_fingerprint = 0;
+    uint256_t vk_hash;
+    PrecomputedPolynomials polynomials;
+
+    /**
+     * @brief Write the precomputed polynomials of proving_key to `path`
+     * @details The file is written to a temporary path first and renamed into place, so that concurrent provers never
+     * map a partially written key.
+     *
+     * @param circuit the circuit proving_key was constructed from
+     * @param vk_hash the hash of the verification key computed from proving_key
+     */
+    static void write(std::string const& path,
+                      ProvingKey& proving_key,
+                      CircuitBuilder& circuit,
+                      const uint256_t& vk_hash);
+
+    /**
+     * @brief Map the proving key file at `path`
+     * @details Aborts if the file is not a valid proving key for this flavor.
+     */
+    static std::shared_ptr<PrecomputedProvingKey_> read(std::string const& path);
+
+    /**
+     * @brief A cheap fingerprint of the structure of a circuit finalized by DeciderProvingKey_
+     * @details Hashes the real variable indices and tags of the wires and the selectors of every block, the tag
+     * permutation, the lookup tables and the memory records, i.e. what the precomputed polynomials are computed from,
+     * but nothing that depends on the witness. It is meant to catch a key being used for the wrong circuit, and is not
+     * collision resistant.
+     */
+    static uint64_t compute_circuit_fingerprint(CircuitBuilder& circuit);
+};
+
+} // namespace bb
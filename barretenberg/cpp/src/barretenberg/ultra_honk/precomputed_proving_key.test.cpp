@@ -0,0 +1,235 @@
+#ifndef __wasm__
+#include "barretenberg/ultra_honk/precomputed_proving_key.hpp"
+#include "barretenberg/stdlib_circuit_builders/mock_circuits.hpp"
+#include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+template <typename Flavor> class PrecomputedProvingKeyTests : public ::testing::Test {
+  public:
+    using Builder = typename Flavor::CircuitBuilder;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+    using PrecomputedProvingKey = PrecomputedProvingKey_<Flavor>;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+    /**
+     * @brief A circuit using public inputs, lookups and RAM (and ecc ops for Mega), whose structure does not depend on
+     * its (random) witness
+     */
+    static Builder construct_circuit()
+    {
+        Builder builder;
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 2);
+        MockCircuits::add_arithmetic_gates(builder);
+        MockCircuits::add_lookup_gates(builder);
+        MockCircuits::add_RAM_gates(builder);
+        if constexpr (IsGoblinFlavor<Flavor>) {
+            MockCircuits::construct_goblin_ecc_op_circuit(builder);
+        }
+        return builder;
+    }
+
+    /**
+     * @brief construct_circuit() with one more addition gate, whose first wire is scaled by `scaling`
+     */
+    static Builder construct_circuit_with_scaled_gate(const fr& scaling)
+    {
+        Builder builder = construct_circuit();
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        const uint32_t a_idx = builder.add_variable(a);
+        const uint32_t b_idx = builder.add_variable(b);
+        const uint32_t c_idx = builder.add_variable(scaling * a + b);
+        builder.create_add_gate({ a_idx, b_idx, c_idx, scaling, 1, -1, 0 });
+        return builder;
+    }
+
+    /**
+     * @brief construct_circuit() with one more addition gate, two of whose wires are tagged with a pair of tags that
+     * map to each other, the first wire with the first tag unless `swap_tags`
+     */
+    static Builder construct_circuit_with_tagged_gate(bool swap_tags)
+    {
+        Builder builder = construct_circuit_with_scaled_gate(1);
+        const uint32_t a_idx = builder.add_variable(fr::random_element());
+        const uint32_t b_idx = builder.add_variable(fr::random_element());
+        builder.create_add_gate({ a_idx, b_idx, builder.zero_idx, 1, -1, 0, 0 });
+        const uint32_t first_tag = builder.get_new_tag();
+        const uint32_t second_tag = builder.get_new_tag();
+        builder.create_tag(first_tag, second_tag);
+        builder.create_tag(second_tag, first_tag);
+        builder.assign_tag(swap_tags ? b_idx : a_idx, first_tag);
+        builder.assign_tag(swap_tags ? a_idx : b_idx, second_tag);
+        return builder;
+    }
+
+    /**
+     * @brief A key file path unique to the running test and flavor, so that tests can run concurrently
+     */
+    static std::string key_path()
+    {
+        const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string path = std::string(test_info->test_suite_name()) + "_" + test_info->name() + ".pk";
+        std::replace(path.begin(), path.end(), '/', '_');
+        return path;
+    }
+
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_crs_factory("../srs_db/ignition"); }
+};
+
+using FlavorTypes = testing::Types<UltraFlavor, MegaFlavor>;
+TYPED_TEST_SUITE(PrecomputedProvingKeyTests, FlavorTypes);
+
+/**
+ * @brief A proving key constructed from a precomputed key read back from disk is identical to one constructed from the
+ * circuit alone, including for a circuit with a different witness from the one the key was written for
+ */
+TYPED_TEST(PrecomputedProvingKeyTests, MatchesFullConstruction)
+{
+    using Builder = typename TestFixture::Builder;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using PrecomputedProvingKey = typename TestFixture::PrecomputedProvingKey;
+
+    const std::string path = TestFixture::key_path();
+    const uint256_t vk_hash{ 1, 2, 3, 4 };
+    {
+        Builder builder = TestFixture::construct_circuit();
+        DeciderProvingKey proving_key(builder);
+        PrecomputedProvingKey::write(path, proving_key.proving_key, builder, vk_hash);
+    }
+    auto precomputed = PrecomputedProvingKey::read(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(precomputed->vk_hash, vk_hash);
+
+    Builder builder = TestFixture::construct_circuit();
+    Builder builder_copy = builder;
+    DeciderProvingKey expected(builder);
+    DeciderProvingKey proving_key(builder_copy, TraceSettings{}, nullptr, precomputed);
+
+    EXPECT_EQ(precomputed->circuit_size, expected.proving_key.circuit_size);
+    EXPECT_EQ(precomputed->pub_inputs_offset, expected.proving_key.pub_inputs_offset);
+    EXPECT_EQ(proving_key.proving_key.public_inputs, expected.proving_key.public_inputs);
+    EXPECT_EQ(proving_key.proving_key.memory_read_records, expected.proving_key.memory_read_records);
+    EXPECT_EQ(proving_key.proving_key.memory_write_records, expected.proving_key.memory_write_records);
+    // The precomputed polynomials point into the mapping rather than being reconstructed
+    for (auto [polynomial, precomputed_polynomial] :
+         zip_view(proving_key.proving_key.polynomials.get_precomputed(), precomputed->polynomials.get_all())) {
+        EXPECT_EQ(polynomial.data(), precomputed_polynomial.data());
+    }
+    for (auto [polynomial, expected_polynomial] :
+         zip_view(proving_key.proving_key.polynomials.get_all(), expected.proving_key.polynomials.get_all())) {
+        EXPECT_EQ(polynomial, expected_polynomial);
+    }
+}
+
+/**
+ * @brief A precomputed key is rejected for a circuit of a different shape, and a key file is tied to its flavor
+ */
+TYPED_TEST(PrecomputedProvingKeyTests, RejectsMismatchedCircuit)
+{
+    using Builder = typename TestFixture::Builder;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using PrecomputedProvingKey = typename TestFixture::PrecomputedProvingKey;
+
+    const std::string path = TestFixture::key_path();
+    {
+        Builder builder = TestFixture::construct_circuit();
+        DeciderProvingKey proving_key(builder);
+        PrecomputedProvingKey::write(path, proving_key.proving_key, builder, uint256_t(0));
+    }
+    auto precomputed = PrecomputedProvingKey::read(path);
+    if constexpr (std::same_as<TypeParam, UltraFlavor>) {
+        EXPECT_THROW(PrecomputedProvingKey_<MegaFlavor>::read(path), std::runtime_error);
+    } else {
+        EXPECT_THROW(PrecomputedProvingKey_<UltraFlavor>::read(path), std::runtime_error);
+    }
+    std::remove(path.c_str());
+
+    Builder builder = TestFixture::construct_circuit();
+    MockCircuits::add_arithmetic_gates_with_public_inputs(builder, 1);
+    EXPECT_THROW(std::make_shared<DeciderProvingKey>(builder, TraceSettings{}, nullptr, precomputed),
+                 std::runtime_error);
+}
+
+/**
+ * @brief A precomputed key is rejected for a different circuit of the same size and number of public inputs
+ */
+TYPED_TEST(PrecomputedProvingKeyTests, RejectsDifferentCircuitOfSameShape)
+{
+    using Builder = typename TestFixture::Builder;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using PrecomputedProvingKey = typename TestFixture::PrecomputedProvingKey;
+
+    const std::string path = TestFixture::key_path();
+    {
+        Builder builder = TestFixture::construct_circuit_with_scaled_gate(1);
+        DeciderProvingKey proving_key(builder);
+        PrecomputedProvingKey::write(path, proving_key.proving_key, builder, uint256_t(0));
+    }
+    auto precomputed = PrecomputedProvingKey::read(path);
+    std::remove(path.c_str());
+
+    Builder same_circuit = TestFixture::construct_circuit_with_scaled_gate(1);
+    Builder different_circuit = TestFixture::construct_circuit_with_scaled_gate(2);
+    EXPECT_EQ(different_circuit.num_gates, same_circuit.num_gates);
+    EXPECT_EQ(different_circuit.public_inputs.size(), same_circuit.public_inputs.size());
+
+    EXPECT_NO_THROW(std::make_shared<DeciderProvingKey>(same_circuit, TraceSettings{}, nullptr, precomputed));
+    EXPECT_THROW(std::make_shared<DeciderProvingKey>(different_circuit, TraceSettings{}, nullptr, precomputed),
+                 std::runtime_error);
+}
+
+/**
+ * @brief The fingerprint tells apart circuits which differ only in the tags of their variables
+ */
+TYPED_TEST(PrecomputedProvingKeyTests, FingerprintCoversTags)
+{
+    using Builder = typename TestFixture::Builder;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using PrecomputedProvingKey = typename TestFixture::PrecomputedProvingKey;
+
+    // Finalize both circuits the way DeciderProvingKey_ does before fingerprinting them
+    Builder circuit = TestFixture::construct_circuit_with_tagged_gate(false);
+    Builder swapped_circuit = TestFixture::construct_circuit_with_tagged_gate(true);
+    DeciderProvingKey proving_key(circuit);
+    DeciderProvingKey swapped_proving_key(swapped_circuit);
+    EXPECT_EQ(swapped_circuit.num_gates, circuit.num_gates);
+
+    EXPECT_NE(PrecomputedProvingKey::compute_circuit_fingerprint(circuit),
+              PrecomputedProvingKey::compute_circuit_fingerprint(swapped_circuit));
+}
+
+TYPED_TEST(PrecomputedProvingKeyTests, ProveAndVerify)
+{
+    using Builder = typename TestFixture::Builder;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+    using PrecomputedProvingKey = typename TestFixture::PrecomputedProvingKey;
+    using VerificationKey = typename TestFixture::VerificationKey;
+
+    const std::string path = TestFixture::key_path();
+    std::shared_ptr<VerificationKey> verification_key;
+    {
+        Builder builder = TestFixture::construct_circuit();
+        DeciderProvingKey proving_key(builder);
+        verification_key = std::make_shared<VerificationKey>(proving_key.proving_key);
+        PrecomputedProvingKey::write(path, proving_key.proving_key, builder, verification_key->hash());
+    }
+    auto precomputed = PrecomputedProvingKey::read(path);
+    std::remove(path.c_str());
+    EXPECT_EQ(precomputed->vk_hash, verification_key->hash());
+
+    Builder builder = TestFixture::construct_circuit();
+    auto proving_key = std::make_shared<DeciderProvingKey>(builder, TraceSettings{}, nullptr, precomputed);
+    UltraProver_<TypeParam> prover(proving_key);
+    auto proof = prover.construct_proof();
+    UltraVerifier_<TypeParam> verifier(verification_key);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+#endif
@@ -9,6 +9,7 @@
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/sumcheck/sumcheck_round.hpp"
+#include "barretenberg/ultra_honk/batch_verifier.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
@@ -949,4 +950,69 @@ TYPED_TEST(UltraHonkTests, range_constraint_small_variable)
     circuit_builder.assert_equal(a_idx, c_idx);
 
     TestFixture::prove_and_verify(circuit_builder, /*expected_result=*/true);
-}
\ No newline at end of file
+}
+/**
+ * @brief Verify proofs of circuits of different sizes with a single pairing, and check that the batch is rejected when
+ * one of its proofs only fails the pairing check
+ */
+TYPED_TEST(UltraHonkTests, BatchVerification)
+{
+    using Flavor = TypeParam;
+    using Commitment = typename Flavor::Commitment;
+    using VerificationKey = typename TestFixture::VerificationKey;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+    for (size_t log_size = 5; log_size < 8; log_size++) {
+        auto circuit_builder = UltraCircuitBuilder();
+        MockCircuits::construct_arithmetic_circuit(circuit_builder, log_size);
+        auto proving_key = std::make_shared<DeciderProvingKey>(circuit_builder);
+        typename TestFixture::Prover prover(proving_key);
+        verification_keys.emplace_back(std::make_shared<VerificationKey>(proving_key->proving_key));
+        proofs.emplace_back(prover.construct_proof());
+    }
+    EXPECT_TRUE(BatchVerifier_<Flavor>::verify(verification_keys, proofs));
+
+    // Swap the KZG quotient commitments, the last elements of the proofs, of the last two proofs. Nothing is derived
+    // from them in the transcript, so both proofs only fail at the pairing
+    const auto frs_per_G = static_cast<std::ptrdiff_t>(bb::field_conversion::calc_num_bn254_frs<Commitment>());
+    std::swap_ranges(proofs[1].end() - frs_per_G, proofs[1].end(), proofs[2].end() - frs_per_G);
+    typename TestFixture::Verifier verifier(verification_keys[1]);
+    EXPECT_FALSE(verifier.verify_proof(proofs[1]));
+    EXPECT_FALSE(BatchVerifier_<Flavor>::verify(verification_keys, proofs));
+}
+
+/**
+ * @brief A batch containing a malformed proof, truncated or garbage, is rejected rather than throwing
+ */
+TYPED_TEST(UltraHonkTests, BatchVerificationRejectsMalformedProofs)
+{
+    using Flavor = TypeParam;
+    using VerificationKey = typename TestFixture::VerificationKey;
+    using DeciderProvingKey = typename TestFixture::DeciderProvingKey;
+
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+    for (size_t i = 0; i < 3; i++) {
+        auto circuit_builder = UltraCircuitBuilder();
+        MockCircuits::construct_arithmetic_circuit(circuit_builder, 5);
+        auto proving_key = std::make_shared<DeciderProvingKey>(circuit_builder);
+        typename TestFixture::Prover prover(proving_key);
+        verification_keys.emplace_back(std::make_shared<VerificationKey>(proving_key->proving_key));
+        proofs.emplace_back(prover.construct_proof());
+    }
+    EXPECT_TRUE(BatchVerifier_<Flavor>::verify(verification_keys, proofs));
+
+    auto truncated_proofs = proofs;
+    truncated_proofs[1].resize(truncated_proofs[1].size() / 2);
+    EXPECT_FALSE(BatchVerifier_<Flavor>::verify(verification_keys, truncated_proofs));
+
+    auto garbage_proofs = proofs;
+    for (auto& element : garbage_proofs[2]) {
+        element = fr::random_element();
+    }
+    EXPECT_FALSE(BatchVerifier_<Flavor>::verify(verification_keys, garbage_proofs));
+
+    EXPECT_FALSE(BatchVerifier_<Flavor>::verify(verification_keys, { proofs[0], {}, proofs[2] }));
+}
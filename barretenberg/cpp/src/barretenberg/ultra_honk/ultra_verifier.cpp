@@ -11,7 +11,23 @@ namespace bb {
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
 {
-    using FF = typename Flavor::FF;
+    return verify_oink_and_gate_challenges(proof).verify();
+}
+
+template <typename Flavor>
+std::optional<BatchOpeningClaim<typename Flavor::Curve>> UltraVerifier_<Flavor>::reduce_to_pairing_claim(
+    const HonkProof& proof)
+{
+    return verify_oink_and_gate_challenges(proof).reduce_to_pairing_claim();
+}
+
+/**
+ * @brief Run the Oink verifier and draw the gate challenges, returning a decider verifier over the rest of the proof
+ */
+template <typename Flavor>
+typename UltraVerifier_<Flavor>::DeciderVerifier UltraVerifier_<Flavor>::verify_oink_and_gate_challenges(
+    const HonkProof& proof)
+{
 
     transcript = std::make_shared<Transcript>(proof);
     OinkVerifier<Flavor> oink_verifier{ verification_key, transcript };
@@ -22,9 +38,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
             transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx)));
     }
 
-    DeciderVerifier decider_verifier{ verification_key, transcript };
-
-    return decider_verifier.verify();
+    return DeciderVerifier{ verification_key, transcript };
 }
 
 template class UltraVerifier_<UltraFlavor>;
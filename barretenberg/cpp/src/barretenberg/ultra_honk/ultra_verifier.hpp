@@ -10,6 +10,7 @@
 namespace bb {
 template <typename Flavor> class UltraVerifier_ {
     using FF = typename Flavor::FF;
+    using Curve = typename Flavor::Curve;
     using Commitment = typename Flavor::Commitment;
     using VerificationKey = typename Flavor::VerificationKey;
     using VerifierCommitmentKey = typename Flavor::VerifierCommitmentKey;
@@ -24,8 +25,18 @@ template <typename Flavor> class UltraVerifier_ {
 
     bool verify_proof(const HonkProof& proof);
 
+    /**
+     * @brief Run every check of verify_proof except the final pairing, which is deferred to the caller
+     * @details Used to verify many proofs with a single pairing (see BatchVerifier_).
+     * @return The pairing claim of DeciderVerifier_::reduce_to_pairing_claim, or std::nullopt if sumcheck failed
+     */
+    std::optional<BatchOpeningClaim<Curve>> reduce_to_pairing_claim(const HonkProof& proof);
+
     std::shared_ptr<Transcript> transcript{ nullptr };
     std::shared_ptr<DeciderVK> verification_key;
+
+  private:
+    DeciderVerifier verify_oink_and_gate_challenges(const HonkProof& proof);
 };
 
 using UltraVerifier = UltraVerifier_<UltraFlavor>;
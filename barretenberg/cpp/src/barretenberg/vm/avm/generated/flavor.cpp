@@ -2578,14 +2578,6 @@ void AvmFlavor::Transcript::serialize_full_transcript()
     ASSERT(proof_data.size() == old_proof_length);
 }
 
-AvmFlavor::PartiallyEvaluatedMultivariates::PartiallyEvaluatedMultivariates(const size_t circuit_size)
-{
-    // Storage is only needed after the first partial evaluation, hence polynomials of size (n / 2)
-    for (auto& poly : get_all()) {
-        poly = Polynomial(circuit_size / 2);
-    }
-}
-
 AvmFlavor::ProvingKey::ProvingKey(const size_t circuit_size, const size_t num_public_inputs)
     : circuit_size(circuit_size)
     , evaluation_domain(bb::EvaluationDomain<FF>(circuit_size, circuit_size))
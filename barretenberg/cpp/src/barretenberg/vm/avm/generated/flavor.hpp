@@ -442,7 +442,6 @@ class AvmFlavor {
     class PartiallyEvaluatedMultivariates : public AllEntities<Polynomial> {
       public:
         PartiallyEvaluatedMultivariates() = default;
-        PartiallyEvaluatedMultivariates(const size_t circuit_size);
     };
 
     /**
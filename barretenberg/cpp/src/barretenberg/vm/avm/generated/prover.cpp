@@ -52,8 +52,9 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     auto labels = commitment_labels.get_wires();
+    auto commitments = commitment_key->batch_commit_sparse(wire_polys);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit_sparse(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
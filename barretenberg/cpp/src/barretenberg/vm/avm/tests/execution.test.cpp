@@ -182,6 +182,44 @@ TEST_F(AvmExecutionTests, basicAddReturn)
     validate_trace(std::move(trace), public_inputs, {}, {});
 }
 
+// The decoded bytecode must hold exactly the instructions found by static parsing, at their pcs, and leave
+// positions which do not start a valid instruction (here a truncated trailing ADD) to the parser.
+TEST_F(AvmExecutionTests, decodedBytecodeMatchesStaticParsing)
+{
+    std::string bytecode_hex = to_hex(OpCode::SET_8) +       // opcode SET
+                               "00"                          // Indirect flag
+                               + to_hex(AvmMemoryTag::U32) + //
+                               "07"                          // val 7
+                               "00"                          // dst_offset 0
+                               + to_hex(OpCode::ADD_16) +    // opcode ADD
+                               "00"                          // Indirect flag
+                               "0000"                        // addr a 0
+                               "0000"                        // addr b 0
+                               "0001"                        // addr c 1
+                               + to_hex(OpCode::ADD_16) +    // opcode ADD, truncated
+                               "00"                          // Indirect flag
+                               "00";                         // half of addr a
+
+    auto bytecode = hex_to_bytes(bytecode_hex);
+    const auto decoded = DecodedBytecode::get(bytecode);
+    EXPECT_EQ(decoded, DecodedBytecode::get(bytecode));
+
+    const uint32_t add_pc = Deserialization::get_pc_increment(OpCode::SET_8);
+    const uint32_t truncated_pc = add_pc + Deserialization::get_pc_increment(OpCode::ADD_16);
+    for (uint32_t pc = 0; pc <= bytecode.size(); pc++) {
+        const Instruction* instruction = decoded->find(pc);
+        if (pc == 0 || pc == add_pc) {
+            ASSERT_NE(instruction, nullptr);
+            auto parsed = Deserialization::parse(bytecode, pc);
+            EXPECT_EQ(instruction->op_code, parsed.op_code);
+            EXPECT_EQ(instruction->operands, parsed.operands);
+        } else {
+            EXPECT_EQ(instruction, nullptr);
+        }
+    }
+    EXPECT_THROW_WITH_MESSAGE(Deserialization::parse(bytecode, truncated_pc), "Operand is missing");
+}
+
 // Positive test for SET and SUB opcodes
 TEST_F(AvmExecutionTests, setAndSubOpcodes)
 {
@@ -3,8 +3,9 @@
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/fixed_bytes.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_counter.hpp"
 
-#include <unordered_map>
 
 namespace bb::avm_trace {
 
@@ -29,8 +30,8 @@ class AvmBinaryTraceBuilder {
         uint8_t bin_ic_bytes = 0;
     };
 
-    std::unordered_map<uint32_t, uint32_t> byte_operation_counter;
-    std::unordered_map<uint32_t, uint32_t> byte_length_counter;
+    ByteOperationCounter byte_operation_counter;
+    U8MultiplicityCounter byte_length_counter;
 
     AvmBinaryTraceBuilder() = default;
 
@@ -5,11 +5,17 @@
 #include "barretenberg/vm/avm/trace/instructions.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -193,116 +199,108 @@ const std::unordered_map<OperandType, uint32_t> OPERAND_TYPE_SIZE = {
     { OperandType::UINT64, 8 },    { OperandType::UINT128, 16 },   { OperandType::FF, 32 }
 };
 
-} // Anonymous namespace
-
-// TODO: once opcodes are frozen, this function can be replaced by a table/map of constants
-uint32_t Deserialization::get_pc_increment(OpCode opcode)
-{
-    const auto iter = OPCODE_WIRE_FORMAT.find(opcode);
-
-    if (iter == OPCODE_WIRE_FORMAT.end()) {
-        return 0;
-    }
-
-    // OPCODE_WIRE_FORMAT does not contain the opcode itself which accounts for 1 byte
-    uint32_t increment = 1;
-
-    const std::vector<OperandType>& inst_format = iter->second;
-    for (const auto& op_type : inst_format) {
-        increment += OPERAND_TYPE_SIZE.at(op_type);
+// PC increment of every opcode, indexed by opcode byte. Zero for opcodes without a wire format.
+const std::array<uint32_t, static_cast<size_t>(OpCode::LAST_OPCODE_SENTINEL)> PC_INCREMENTS = [] {
+    std::array<uint32_t, static_cast<size_t>(OpCode::LAST_OPCODE_SENTINEL)> increments{};
+    for (const auto& [opcode, inst_format] : OPCODE_WIRE_FORMAT) {
+        // OPCODE_WIRE_FORMAT does not contain the opcode itself which accounts for 1 byte
+        uint32_t increment = 1;
+        for (const auto& op_type : inst_format) {
+            increment += OPERAND_TYPE_SIZE.at(op_type);
+        }
+        increments[static_cast<size_t>(opcode)] = increment;
     }
-
-    return increment;
-}
+    return increments;
+}();
 
 /**
- * @brief Parsing of an instruction in the supplied bytecode at byte position pos. This
- *        checks that the opcode value is in the defined range and extracts the operands
- *        for each opcode based on the specification from OPCODE_WIRE_FORMAT.
- *
- * @param bytecode The bytecode to be parsed as a vector of bytes/uint8_t
- * @param pos Bytecode position
- * @throws runtime_error exception when the bytecode is invalid or pos is out-of-range
- * @return The instruction
+ * @brief Decode the instruction at byte position pos, reporting failures through error instead of throwing so that
+ *        bytecode can be decoded ahead of execution.
  */
-Instruction Deserialization::parse(const std::vector<uint8_t>& bytecode, size_t pos)
+std::optional<Instruction> decode(const std::vector<uint8_t>& bytecode, size_t pos, std::string& error)
 {
     const auto length = bytecode.size();
 
     if (pos >= length) {
-        throw_or_abort("Position is out of range. Position: " + std::to_string(pos) +
-                       " Bytecode length: " + std::to_string(length));
+        error = "Position is out of range. Position: " + std::to_string(pos) +
+                " Bytecode length: " + std::to_string(length);
+        return std::nullopt;
     }
 
-    const uint8_t opcode_byte = bytecode.at(pos);
+    const uint8_t opcode_byte = bytecode[pos];
 
     if (!Bytecode::is_valid(opcode_byte)) {
-        throw_or_abort("Invalid opcode byte: " + to_hex(opcode_byte) + " at position: " + std::to_string(pos));
+        error = "Invalid opcode byte: " + to_hex(opcode_byte) + " at position: " + std::to_string(pos);
+        return std::nullopt;
     }
     pos++;
 
     const auto opcode = static_cast<OpCode>(opcode_byte);
     const auto iter = OPCODE_WIRE_FORMAT.find(opcode);
     if (iter == OPCODE_WIRE_FORMAT.end()) {
-        throw_or_abort("Opcode not found in OPCODE_WIRE_FORMAT: " + to_hex(opcode) + " name " + to_string(opcode));
+        error = "Opcode not found in OPCODE_WIRE_FORMAT: " + to_hex(opcode) + " name " + to_string(opcode);
+        return std::nullopt;
     }
     const std::vector<OperandType>& inst_format = iter->second;
 
     std::vector<Operand> operands;
+    operands.reserve(inst_format.size());
     for (OperandType const& op_type : inst_format) {
         // No underflow as above condition guarantees pos <= length (after pos++)
         const auto operand_size = OPERAND_TYPE_SIZE.at(op_type);
         if (length - pos < operand_size) {
-            throw_or_abort("Operand is missing at position " + std::to_string(pos) + " for opcode " + to_hex(opcode) +
-                           " not enough bytes for operand type " + std::to_string(static_cast<int>(op_type)));
+            error = "Operand is missing at position " + std::to_string(pos) + " for opcode " + to_hex(opcode) +
+                    " not enough bytes for operand type " + std::to_string(static_cast<int>(op_type));
+            return std::nullopt;
         }
 
         switch (op_type) {
         case OperandType::TAG: {
-            uint8_t tag_u8 = bytecode.at(pos);
+            uint8_t tag_u8 = bytecode[pos];
             if (tag_u8 > MAX_MEM_TAG) {
-                throw_or_abort("Instruction tag is invalid at position " + std::to_string(pos) +
-                               " value: " + std::to_string(tag_u8) + " for opcode: " + to_string(opcode));
+                error = "Instruction tag is invalid at position " + std::to_string(pos) +
+                        " value: " + std::to_string(tag_u8) + " for opcode: " + to_string(opcode);
+                return std::nullopt;
             }
             operands.emplace_back(static_cast<AvmMemoryTag>(tag_u8));
             break;
         }
         case OperandType::INDIRECT8:
         case OperandType::UINT8:
-            operands.emplace_back(bytecode.at(pos));
+            operands.emplace_back(bytecode[pos]);
             break;
         case OperandType::INDIRECT16:
         case OperandType::UINT16: {
             uint16_t operand_u16 = 0;
-            uint8_t const* pos_ptr = &bytecode.at(pos);
+            uint8_t const* pos_ptr = &bytecode[pos];
             serialize::read(pos_ptr, operand_u16);
             operands.emplace_back(operand_u16);
             break;
         }
         case OperandType::UINT32: {
             uint32_t operand_u32 = 0;
-            uint8_t const* pos_ptr = &bytecode.at(pos);
+            uint8_t const* pos_ptr = &bytecode[pos];
             serialize::read(pos_ptr, operand_u32);
             operands.emplace_back(operand_u32);
             break;
         }
         case OperandType::UINT64: {
             uint64_t operand_u64 = 0;
-            uint8_t const* pos_ptr = &bytecode.at(pos);
+            uint8_t const* pos_ptr = &bytecode[pos];
             serialize::read(pos_ptr, operand_u64);
             operands.emplace_back(operand_u64);
             break;
         }
         case OperandType::UINT128: {
             uint128_t operand_u128 = 0;
-            uint8_t const* pos_ptr = &bytecode.at(pos);
+            uint8_t const* pos_ptr = &bytecode[pos];
             serialize::read(pos_ptr, operand_u128);
             operands.emplace_back(operand_u128);
             break;
         }
         case OperandType::FF: {
             FF operand_ff;
-            uint8_t const* pos_ptr = &bytecode.at(pos);
+            uint8_t const* pos_ptr = &bytecode[pos];
             read(pos_ptr, operand_ff);
             operands.emplace_back(operand_ff);
         }
@@ -310,8 +308,35 @@ Instruction Deserialization::parse(const std::vector<uint8_t>& bytecode, size_t
         pos += operand_size;
     }
 
-    auto instruction = Instruction(opcode, operands);
-    return instruction;
+    return Instruction(opcode, std::move(operands));
+}
+
+} // Anonymous namespace
+
+uint32_t Deserialization::get_pc_increment(OpCode opcode)
+{
+    const auto index = static_cast<size_t>(opcode);
+    return index < PC_INCREMENTS.size() ? PC_INCREMENTS[index] : 0;
+}
+
+/**
+ * @brief Parsing of an instruction in the supplied bytecode at byte position pos. This
+ *        checks that the opcode value is in the defined range and extracts the operands
+ *        for each opcode based on the specification from OPCODE_WIRE_FORMAT.
+ *
+ * @param bytecode The bytecode to be parsed as a vector of bytes/uint8_t
+ * @param pos Bytecode position
+ * @throws runtime_error exception when the bytecode is invalid or pos is out-of-range
+ * @return The instruction
+ */
+Instruction Deserialization::parse(const std::vector<uint8_t>& bytecode, size_t pos)
+{
+    std::string error;
+    std::optional<Instruction> instruction = decode(bytecode, pos, error);
+    if (!instruction.has_value()) {
+        throw_or_abort(error);
+    }
+    return std::move(*instruction);
 };
 
 /**
@@ -335,4 +360,59 @@ std::vector<Instruction> Deserialization::parse_bytecode_statically(const std::v
     return instructions;
 }
 
+/**
+ * @brief Decode the bytecode ahead of execution by following it statically from pc 0. Decoding stops at the first
+ *        position which does not hold a valid instruction; such positions are left to Deserialization::parse so that
+ *        executing them fails exactly as before.
+ */
+DecodedBytecode::DecodedBytecode(std::vector<uint8_t> bytecode)
+    : bytecode(std::move(bytecode))
+    , instruction_index(this->bytecode.size(), NOT_DECODED)
+{
+    std::string error;
+    size_t pc = 0;
+    while (pc < this->bytecode.size()) {
+        std::optional<Instruction> instruction = decode(this->bytecode, pc, error);
+        if (!instruction.has_value()) {
+            break;
+        }
+        const OpCode opcode = instruction->op_code;
+        instruction_index[pc] = static_cast<uint32_t>(instructions.size());
+        instructions.emplace_back(std::move(*instruction));
+        pc += Deserialization::get_pc_increment(opcode);
+    }
+}
+
+/**
+ * @brief Get the decoded bytecode of a contract, decoding it only the first time this bytecode is seen in the process
+ * @details Entries are looked up by a hash of the bytecode and confirmed by comparing the bytes, so a hash collision
+ *          can only cost a decode. The cache is emptied once it holds MAX_CACHED_BYTECODES contracts.
+ */
+std::shared_ptr<const DecodedBytecode> DecodedBytecode::get(const std::vector<uint8_t>& bytecode)
+{
+    static std::mutex mutex;
+    static std::unordered_multimap<size_t, std::shared_ptr<const DecodedBytecode>> cache;
+
+    const size_t hash = std::hash<std::string_view>{}(
+        std::string_view(reinterpret_cast<const char*>(bytecode.data()), bytecode.size()));
+    {
+        std::unique_lock lock(mutex);
+        const auto [begin, end] = cache.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            if (it->second->bytecode == bytecode) {
+                return it->second;
+            }
+        }
+    }
+
+    // Decode outside of the lock; two threads racing on the same new bytecode both decode it, which is harmless
+    auto decoded = std::make_shared<const DecodedBytecode>(bytecode);
+    std::unique_lock lock(mutex);
+    if (cache.size() >= MAX_CACHED_BYTECODES) {
+        cache.clear();
+    }
+    cache.emplace(hash, decoded);
+    return decoded;
+}
+
 } // namespace bb::avm_trace
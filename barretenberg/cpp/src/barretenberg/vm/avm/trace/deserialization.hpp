@@ -4,6 +4,8 @@
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 #include <cstdint>
+#include <limits>
+#include <memory>
 #include <vector>
 
 namespace bb::avm_trace {
@@ -23,4 +25,37 @@ class Deserialization {
     static uint32_t get_pc_increment(OpCode opcode);
 };
 
+/**
+ * @brief The bytecode of a contract together with its instructions, decoded once ahead of execution
+ * @details The execution loop looks instructions up by pc instead of re-parsing (and re-allocating) the same
+ *          instruction every time it is executed. Positions which are not reached by decoding the bytecode statically
+ *          (e.g. jumps into the middle of an instruction, or invalid trailing bytes) are not cached.
+ */
+class DecodedBytecode {
+  public:
+    explicit DecodedBytecode(std::vector<uint8_t> bytecode);
+
+    static std::shared_ptr<const DecodedBytecode> get(const std::vector<uint8_t>& bytecode);
+
+    /**
+     * @brief The instruction starting at pc, or nullptr if none was decoded there
+     */
+    const Instruction* find(uint32_t pc) const
+    {
+        if (pc >= instruction_index.size() || instruction_index[pc] == NOT_DECODED) {
+            return nullptr;
+        }
+        return &instructions[instruction_index[pc]];
+    }
+
+    const std::vector<uint8_t> bytecode;
+
+  private:
+    static constexpr uint32_t NOT_DECODED = std::numeric_limits<uint32_t>::max();
+    static constexpr size_t MAX_CACHED_BYTECODES = 256;
+
+    std::vector<Instruction> instructions;
+    std::vector<uint32_t> instruction_index; // Index into instructions of the instruction starting at each pc
+};
+
 } // namespace bb::avm_trace
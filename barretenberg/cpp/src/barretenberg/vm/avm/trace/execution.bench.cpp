@@ -0,0 +1,121 @@
+#include "barretenberg/common/utils.hpp"
+#include "barretenberg/vm/avm/trace/bytecode_trace.hpp"
+#include "barretenberg/vm/avm/trace/execution.hpp"
+#include "barretenberg/vm/avm/trace/helper.hpp"
+#include "barretenberg/vm/avm/trace/opcode.hpp"
+#include "barretenberg/vm/aztec_constants.hpp"
+#include "barretenberg/vm/constants.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+using namespace bb::avm_trace;
+
+namespace {
+
+constexpr uint32_t INITIAL_DA_GAS = 1000000;
+constexpr uint32_t INITIAL_L2_GAS = 1000000;
+
+/**
+ * @brief Bytecode of a counting loop: M[0] is incremented until it reaches num_iterations
+ * @details Layout: SET_8 SET_8 SET_32 | ADD_8 LT_8 JUMPI_32 | SET_8 RETURN, with the loop body starting at pc 19.
+ */
+std::vector<uint8_t> counting_loop_bytecode(uint32_t num_iterations)
+{
+    std::string bytecode_hex = to_hex(OpCode::SET_8) +       // opcode SET
+                               "00"                          // Indirect flag
+                               + to_hex(AvmMemoryTag::U32) + //
+                               "00"                          // val 0
+                               "00"                          // dst_offset 0
+                               + to_hex(OpCode::SET_8) +     // opcode SET
+                               "00"                          // Indirect flag
+                               + to_hex(AvmMemoryTag::U32) + //
+                               "01"                          // val 1
+                               "01"                          // dst_offset 1
+                               + to_hex(OpCode::SET_32) +    // opcode SET
+                               "00"                          // Indirect flag
+                               + to_hex(AvmMemoryTag::U32) + //
+                               to_hex(num_iterations) +      // val num_iterations
+                               "0002"                        // dst_offset 2
+                               + to_hex(OpCode::ADD_8) +     // opcode ADD (loop body, pc 19)
+                               "00"                          // Indirect flag
+                               "00"                          // addr a 0
+                               "01"                          // addr b 1
+                               "00"                          // addr c 0
+                               + to_hex(OpCode::LT_8) +      // opcode LT
+                               "00"                          // Indirect flag
+                               "00"                          // addr a 0
+                               "02"                          // addr b 2
+                               "03"                          // addr c 3
+                               + to_hex(OpCode::JUMPI_32) +  // opcode JUMPI
+                               "00"                          // Indirect flag
+                               "00000013"                    // jmp_dest 19
+                               "0003"                        // cond_offset 3
+                               + to_hex(OpCode::SET_8) +     // opcode SET (for return size)
+                               "00"                          // Indirect flag
+                               + to_hex(AvmMemoryTag::U32) + //
+                               "00"                          // val 0
+                               "FF"                          // dst_offset 255
+                               + to_hex(OpCode::RETURN) +    // opcode RETURN
+                               "00"                          // Indirect flag
+                               "0000"                        // ret offset 0
+                               "00FF";                       // ret size offset 255
+    return utils::hex_to_bytes(bytecode_hex);
+}
+
+AvmContractBytecode contract_bytecode(const std::vector<uint8_t>& bytecode)
+{
+    FF public_commitment = AvmBytecodeTraceBuilder::compute_public_bytecode_commitment(bytecode);
+    FF class_id = AvmBytecodeTraceBuilder::compute_contract_class_id(
+        FF::one() /*artifact_hash*/, FF(2) /*private_fn_root*/, public_commitment);
+    PublicKeysHint public_keys{
+        grumpkin::g1::affine_one, grumpkin::g1::affine_one, grumpkin::g1::affine_one, grumpkin::g1::affine_one
+    };
+    ContractInstanceHint contract_instance = {
+        FF::one() /* temp address */,    true /* exists */, FF(2) /* salt */, FF(3) /* deployer_addr */, class_id,
+        FF(8) /* initialisation_hash */, public_keys
+    };
+    contract_instance.address = AvmBytecodeTraceBuilder::compute_address_from_instance(contract_instance);
+    return { bytecode, contract_instance, ContractClassIdHint{ FF::one(), FF(2), public_commitment } };
+}
+
+/**
+ * @brief Simulate a loop of state.range(0) iterations, reporting the rate of executed instructions
+ * @details Trace generation includes finalizing the trace, so this is an end-to-end measure of the simulator. The
+ * loop body is re-executed from the decoded bytecode cache on every iteration.
+ */
+void execute_counting_loop(State& state) noexcept
+{
+    const auto num_iterations = static_cast<uint32_t>(state.range(0));
+    Execution::set_trace_builder_constructor([](VmPublicInputs public_inputs,
+                                                ExecutionHints execution_hints,
+                                                uint32_t side_effect_counter,
+                                                std::vector<FF> calldata) {
+        return AvmTraceBuilder(
+                   std::move(public_inputs), std::move(execution_hints), side_effect_counter, std::move(calldata))
+            .set_full_precomputed_tables(false)
+            .set_range_check_required(false);
+    });
+
+    std::vector<FF> public_inputs_vec(PUBLIC_CIRCUIT_PUBLIC_INPUTS_LENGTH);
+    public_inputs_vec.at(DA_START_GAS_LEFT_PCPI_OFFSET) = INITIAL_DA_GAS;
+    public_inputs_vec.at(L2_START_GAS_LEFT_PCPI_OFFSET) = INITIAL_L2_GAS;
+    public_inputs_vec.at(ADDRESS_PCPI_OFFSET) = 0xdeadbeef;
+    const auto execution_hints =
+        ExecutionHints().with_avm_contract_bytecode({ contract_bytecode(counting_loop_bytecode(num_iterations)) });
+
+    for (auto _ : state) {
+        std::vector<FF> returndata;
+        DoNotOptimize(Execution::gen_trace({}, public_inputs_vec, returndata, execution_hints));
+    }
+    // 3 SETs, 3 instructions per iteration, then SET and RETURN
+    const size_t instructions_per_run = 5 + (3 * static_cast<size_t>(num_iterations));
+    state.counters["instructions"] =
+        Counter(static_cast<double>(instructions_per_run * static_cast<size_t>(state.iterations())), Counter::kIsRate);
+}
+
+} // namespace
+
+BENCHMARK(execute_counting_loop)->RangeMultiplier(4)->Range(1 << 6, 1 << 12)->Unit(kMillisecond);
+
+BENCHMARK_MAIN();
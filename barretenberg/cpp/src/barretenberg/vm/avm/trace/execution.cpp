@@ -24,6 +24,8 @@
 #include <cstdint>
 #include <cstdlib>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -281,6 +283,7 @@ std::vector<Row> Execution::gen_trace(std::vector<FF> const& calldata,
 
     // We should use the public input address, but for now we just take the first element in the list
     const std::vector<uint8_t>& bytecode = execution_hints.all_contract_bytecode.at(0).bytecode;
+    const std::shared_ptr<const DecodedBytecode> decoded_bytecode = DecodedBytecode::get(bytecode);
 
     // Copied version of pc maintained in trace builder. The value of pc is evolving based
     // on opcode logic and therefore is not maintained here. However, the next opcode in the execution
@@ -289,9 +292,18 @@ std::vector<Row> Execution::gen_trace(std::vector<FF> const& calldata,
     uint32_t counter = 0;
     AvmError error = AvmError::NO_ERROR;
     while (error == AvmError::NO_ERROR && (pc = trace_builder.get_pc()) < bytecode.size()) {
-        auto inst = Deserialization::parse(bytecode, pc);
-        debug("[PC:" + std::to_string(pc) + "] [IC:" + std::to_string(counter++) + "] " + inst.to_string() +
-              " (gasLeft l2=" + std::to_string(trace_builder.get_l2_gas_left()) + ")");
+        // Positions not covered by the static decoding are parsed on the spot, which also reports invalid bytecode
+        std::optional<Instruction> parsed_inst;
+        const Instruction* decoded_inst = decoded_bytecode->find(pc);
+        if (decoded_inst == nullptr) {
+            decoded_inst = &parsed_inst.emplace(Deserialization::parse(bytecode, pc));
+        }
+        const Instruction& inst = *decoded_inst;
+        if (debug_logging) {
+            debug("[PC:" + std::to_string(pc) + "] [IC:" + std::to_string(counter) + "] " + inst.to_string() +
+                  " (gasLeft l2=" + std::to_string(trace_builder.get_l2_gas_left()) + ")");
+        }
+        counter++;
 
         switch (inst.op_code) {
             // Compute
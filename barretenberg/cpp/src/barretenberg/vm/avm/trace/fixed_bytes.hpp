@@ -5,17 +5,21 @@
 
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_counter.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 namespace bb::avm_trace {
 
+// Lookup counts into the byte operations table, indexed by (op_id << 16) + (a << 8) + b for the 3 bitwise operations
+using ByteOperationCounter = MultiplicityCounter<3UL << 16>;
+
 class FixedBytesTable {
   public:
     static const FixedBytesTable& get();
 
     void finalize(std::vector<AvmFullRow<FF>>& main_trace) const;
     void finalize_for_testing(std::vector<AvmFullRow<FF>>& main_trace,
-                              const std::unordered_map<uint32_t, uint32_t>& byte_operation_counter) const;
+                              const ByteOperationCounter& byte_operation_counter) const;
 
   private:
     FixedBytesTable() = default;
@@ -48,7 +48,7 @@ void AvmGasTraceBuilder::constrain_gas(
         effective_nested_da_gas_cost = nested_da_gas_cost;
     }
 
-    gas_opcode_lookup_counter[opcode]++;
+    gas_opcode_lookup_counter[static_cast<uint8_t>(opcode)]++;
 
     // Get the gas prices for this opcode
     const auto& GAS_COST_TABLE = FixedGasTable::get();
@@ -171,9 +171,8 @@ void AvmGasTraceBuilder::finalize_lookups(std::vector<AvmFullRow<FF>>& main_trac
 {
     // Finalise gas left lookup counts
     // TODO: find the right place for this. This is not really over the main trace, but over the opcode trace.
-    for (auto const& [opcode, count] : gas_opcode_lookup_counter) {
-        main_trace.at(static_cast<uint8_t>(opcode)).lookup_opcode_gas_counts = count;
-    }
+    gas_opcode_lookup_counter.for_each_nonzero(
+        [&](size_t opcode, uint32_t count) { main_trace.at(opcode).lookup_opcode_gas_counts = count; });
 }
 
 } // namespace bb::avm_trace
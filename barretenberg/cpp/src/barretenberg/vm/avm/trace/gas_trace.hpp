@@ -5,6 +5,7 @@
 
 #include "barretenberg/vm/avm/generated/full_row.hpp"
 #include "barretenberg/vm/avm/trace/common.hpp"
+#include "barretenberg/vm/avm/trace/multiplicity_counter.hpp"
 #include "barretenberg/vm/avm/trace/opcode.hpp"
 
 namespace bb::avm_trace {
@@ -42,10 +43,10 @@ class AvmGasTraceBuilder {
     uint32_t get_l2_gas_left() const;
     uint32_t get_da_gas_left() const;
 
-    // Counts each time an opcode is read: opcode -> count
-    std::unordered_map<OpCode, uint32_t> gas_opcode_lookup_counter;
+    // Counts each time an opcode is read, indexed by opcode
+    U8MultiplicityCounter gas_opcode_lookup_counter;
     // Data structure to collect all lookup counts pertaining to 16-bit range checks related to remaining gas
-    std::array<std::unordered_map<uint16_t, uint32_t>, 4> rem_gas_rng_check_counts;
+    std::array<U16MultiplicityCounter, 4> rem_gas_rng_check_counts;
 
   private:
     std::vector<GasTraceEntry> gas_trace;
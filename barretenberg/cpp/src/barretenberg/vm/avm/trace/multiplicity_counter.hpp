@@ -0,0 +1,60 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::avm_trace {
+
+/**
+ * @brief Lookup multiplicities over a dense key range [0, SIZE), stored as a flat array
+ * @details Lookup counts into the fixed u8/u16 tables (and other small tables) are bumped on every memory access, ALU
+ * operation and range check, so they are kept in an array indexed by the key rather than hashed. Builders which fill
+ * counters independently (e.g. one per gadget or per thread) combine them with merge().
+ */
+template <size_t SIZE> class MultiplicityCounter {
+  public:
+    MultiplicityCounter()
+        : counts(SIZE, 0)
+    {}
+
+    uint32_t& operator[](size_t key)
+    {
+        ASSERT(key < SIZE);
+        return counts[key];
+    }
+    uint32_t operator[](size_t key) const
+    {
+        ASSERT(key < SIZE);
+        return counts[key];
+    }
+
+    static constexpr size_t size() { return SIZE; }
+
+    void merge(MultiplicityCounter const& other)
+    {
+        for (size_t i = 0; i < SIZE; i++) {
+            counts[i] += other.counts[i];
+        }
+    }
+
+    // Calls fn(key, count) for every key with a non-zero count, in increasing key order
+    template <typename Fn> void for_each_nonzero(Fn&& fn) const
+    {
+        for (size_t i = 0; i < SIZE; i++) {
+            if (counts[i] != 0) {
+                fn(i, counts[i]);
+            }
+        }
+    }
+
+  private:
+    std::vector<uint32_t> counts;
+};
+
+using U8MultiplicityCounter = MultiplicityCounter<1UL << 8>;
+using U16MultiplicityCounter = MultiplicityCounter<1UL << 16>;
+
+} // namespace bb::avm_trace
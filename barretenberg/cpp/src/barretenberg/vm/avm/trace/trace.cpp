@@ -52,14 +52,13 @@ uint32_t finalize_rng_chks_for_testing(std::vector<Row>& main_trace,
 {
     // Build the main_trace, and add any new rows with specific clks that line up with lookup reads
 
-    // Is there a "spread-like" operator in cpp or can I make it generic of the first param of the unordered map
-    std::vector<std::unordered_map<uint8_t, uint32_t>> u8_rng_chks = {
+    std::vector<std::reference_wrapper<U8MultiplicityCounter const>> u8_rng_chks = {
         alu_trace_builder.u8_range_chk_counters[0], alu_trace_builder.u8_range_chk_counters[1],
         alu_trace_builder.u8_pow_2_counters[0],     alu_trace_builder.u8_pow_2_counters[1],
         rng_chk_trace_builder.powers_of_2_counts,   mem_trace_builder.mem_rng_chk_u8_counts,
     };
 
-    std::vector<std::reference_wrapper<std::unordered_map<uint16_t, uint32_t> const>> u16_rng_chks;
+    std::vector<std::reference_wrapper<U16MultiplicityCounter const>> u16_rng_chks;
 
     u16_rng_chks.emplace_back(rng_chk_trace_builder.dyn_diff_counts);
     u16_rng_chks.emplace_back(mem_trace_builder.mem_rng_chk_u16_0_counts);
@@ -73,16 +72,13 @@ uint32_t finalize_rng_chks_for_testing(std::vector<Row>& main_trace,
                         gas_trace_builder.rem_gas_rng_check_counts.end());
 
     auto custom_clk = std::set<uint32_t>{};
+    auto insert_clk = [&](size_t key, BB_UNUSED uint32_t count) { custom_clk.insert(static_cast<uint32_t>(key)); };
     for (auto const& row : u8_rng_chks) {
-        for (auto const& [key, value] : row) {
-            custom_clk.insert(key);
-        }
+        row.get().for_each_nonzero(insert_clk);
     }
 
-    for (auto row : u16_rng_chks) {
-        for (auto const& [key, value] : row.get()) {
-            custom_clk.insert(key);
-        }
+    for (auto const& row : u16_rng_chks) {
+        row.get().for_each_nonzero(insert_clk);
     }
 
     for (auto const& [clk, count] : mem_trace_builder.m_tag_err_lookup_counts) {
@@ -346,6 +346,38 @@ fr_sibling_path WorldState::get_sibling_path(const WorldStateRevision& revision,
         fork->_trees.at(tree_id));
 }
 
+std::vector<fr_sibling_path> WorldState::get_sibling_paths(const WorldStateRevision& revision,
+                                                          MerkleTreeId tree_id,
+                                                          const std::vector<index_t>& leaf_indices) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+
+    return std::visit(
+        [&leaf_indices, revision](auto&& wrapper) {
+            Signal signal(1);
+            TypedResponse<GetSiblingPathsResponse> result;
+
+            auto callback = [&signal, &result](const TypedResponse<GetSiblingPathsResponse>& response) {
+                result = response;
+                signal.signal_level(0);
+            };
+
+            if (revision.blockNumber) {
+                wrapper.tree->get_sibling_paths(
+                    leaf_indices, revision.blockNumber, callback, revision.includeUncommitted);
+            } else {
+                wrapper.tree->get_sibling_paths(leaf_indices, callback, revision.includeUncommitted);
+            }
+            signal.wait_for_level(0);
+
+            if (!result.success) {
+                throw std::runtime_error(result.message);
+            }
+            return result.inner.paths;
+        },
+        fork->_trees.at(tree_id));
+}
+
 void WorldState::update_public_data(const PublicDataLeafValue& new_value, Fork::Id fork_id)
 {
     Fork::SharedPtr fork = retrieve_fork(fork_id);
@@ -540,6 +572,40 @@ GetLowIndexedLeafResponse WorldState::find_low_leaf_index(const WorldStateRevisi
     return low_leaf_info;
 }
 
+std::vector<GetLowIndexedLeafResponse> WorldState::find_low_leaf_indices(const WorldStateRevision& revision,
+                                                                        MerkleTreeId tree_id,
+                                                                        const std::vector<bb::fr>& leaf_keys) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+    Signal signal;
+    TypedResponse<GetLowIndexedLeavesResponse> result;
+    auto callback = [&signal, &result](const TypedResponse<GetLowIndexedLeavesResponse>& response) {
+        result = response;
+        signal.signal_level();
+    };
+    auto find = [&](const auto* wrapper) {
+        if (revision.blockNumber != 0U) {
+            wrapper->tree->find_low_leaves(leaf_keys, revision.blockNumber, revision.includeUncommitted, callback);
+        } else {
+            wrapper->tree->find_low_leaves(leaf_keys, revision.includeUncommitted, callback);
+        }
+    };
+
+    if (const auto* wrapper = std::get_if<TreeWithStore<NullifierTree>>(&fork->_trees.at(tree_id))) {
+        find(wrapper);
+    } else if (const auto* wrapper = std::get_if<TreeWithStore<PublicDataTree>>(&fork->_trees.at(tree_id))) {
+        find(wrapper);
+    } else {
+        throw std::runtime_error("Invalid tree type for find_low_leaf");
+    }
+
+    signal.wait_for_level();
+    if (!result.success) {
+        throw std::runtime_error(result.message);
+    }
+    return result.inner.low_leaves;
+}
+
 WorldStateStatus WorldState::set_finalised_blocks(const index_t& toBlockNumber)
 {
     WorldStateRevision revision{ .forkId = CANONICAL_FORK_ID, .blockNumber = 0, .includeUncommitted = false };
@@ -100,6 +100,18 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Get the sibling paths of several leaves in a tree with a single request
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return std::vector<crypto::merkle_tree::fr_sibling_path> The paths, in the order of leaf_indices
+     */
+    std::vector<crypto::merkle_tree::fr_sibling_path> get_sibling_paths(const WorldStateRevision& revision,
+                                                                        MerkleTreeId tree_id,
+                                                                        const std::vector<index_t>& leaf_indices) const;
+
     /**
      * @brief Get the leaf preimage object
      *
@@ -126,6 +138,20 @@ class WorldState {
     template <typename T>
     std::optional<T> get_leaf(const WorldStateRevision& revision, MerkleTreeId tree_id, index_t leaf_index) const;
 
+    /**
+     * @brief Gets the values of several leaves in a tree with a single request
+     *
+     * @tparam T the type of the leaf. Either bb::fr, NullifierLeafValue, PublicDataLeafValue
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return std::vector<std::optional<T>> The values, nullopt for leaves that do not exist
+     */
+    template <typename T>
+    std::vector<std::optional<T>> get_leaves(const WorldStateRevision& revision,
+                                             MerkleTreeId tree_id,
+                                             const std::vector<index_t>& leaf_indices) const;
+
     /**
      * @brief Finds the leaf that would have its nextIdx/nextValue fields modified if the target leaf were to be
      * inserted into the tree. If the vlaue already exists in the tree, the leaf with the same value is returned.
@@ -139,6 +165,17 @@ class WorldState {
                                                                        MerkleTreeId tree_id,
                                                                        const bb::fr& leaf_key) const;
 
+    /**
+     * @brief Finds the low leaves of several keys with a single request
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_keys The leaves to find the predecessors of
+     * @return std::vector<crypto::merkle_tree::GetLowIndexedLeafResponse> In the order of leaf_keys
+     */
+    std::vector<crypto::merkle_tree::GetLowIndexedLeafResponse> find_low_leaf_indices(
+        const WorldStateRevision& revision, MerkleTreeId tree_id, const std::vector<bb::fr>& leaf_keys) const;
+
     /**
      * @brief Finds the index of a leaf in a tree
      *
@@ -154,6 +191,21 @@ class WorldState {
                                            const T& leaf,
                                            index_t start_index = 0) const;
 
+    /**
+     * @brief Finds the indices of several leaves in a tree with a single request
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaves The leaves to find
+     * @param start_index The index to start searching from
+     * @return std::vector<std::optional<index_t>> In the order of leaves
+     */
+    template <typename T>
+    std::vector<std::optional<index_t>> find_leaf_indices(const WorldStateRevision& revision,
+                                                          MerkleTreeId tree_id,
+                                                          const std::vector<T>& leaves,
+                                                          index_t start_index = 0) const;
+
     /**
      * @brief Appends a set of leaves to an existing Merkle Tree.
      *
@@ -384,6 +436,105 @@ std::optional<index_t> WorldState::find_leaf_index(const WorldStateRevision& rev
     return index;
 }
 
+template <typename T>
+std::vector<std::optional<T>> WorldState::get_leaves(const WorldStateRevision& revision,
+                                                     MerkleTreeId tree_id,
+                                                     const std::vector<index_t>& leaf_indices) const
+{
+    using namespace crypto::merkle_tree;
+
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+
+    std::vector<std::optional<T>> leaves;
+    std::string error_msg;
+    bool success = true;
+    Signal signal;
+    if constexpr (std::is_same_v<bb::fr, T>) {
+        const auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(tree_id));
+        auto callback = [&](const TypedResponse<GetLeavesResponse>& resp) {
+            success = resp.success;
+            error_msg = resp.message;
+            leaves = resp.inner.leaves;
+            signal.signal_level();
+        };
+
+        if (revision.blockNumber) {
+            wrapper.tree->get_leaves(leaf_indices, revision.blockNumber, revision.includeUncommitted, callback);
+        } else {
+            wrapper.tree->get_leaves(leaf_indices, revision.includeUncommitted, callback);
+        }
+    } else {
+        using Store = ContentAddressedCachedTreeStore<T>;
+        using Tree = ContentAddressedIndexedTree<Store, HashPolicy>;
+
+        auto& wrapper = std::get<TreeWithStore<Tree>>(fork->_trees.at(tree_id));
+        auto callback = [&](const TypedResponse<GetIndexedLeavesResponse<T>>& resp) {
+            success = resp.success;
+            error_msg = resp.message;
+            leaves.reserve(resp.inner.indexed_leaves.size());
+            for (const auto& indexed_leaf : resp.inner.indexed_leaves) {
+                leaves.emplace_back(indexed_leaf.has_value() ? std::optional<T>(indexed_leaf.value().value)
+                                                             : std::nullopt);
+            }
+            signal.signal_level();
+        };
+
+        if (revision.blockNumber) {
+            wrapper.tree->get_leaves(leaf_indices, revision.blockNumber, revision.includeUncommitted, callback);
+        } else {
+            wrapper.tree->get_leaves(leaf_indices, revision.includeUncommitted, callback);
+        }
+    }
+
+    signal.wait_for_level();
+    if (!success) {
+        throw std::runtime_error(error_msg);
+    }
+    return leaves;
+}
+
+template <typename T>
+std::vector<std::optional<index_t>> WorldState::find_leaf_indices(const WorldStateRevision& rev,
+                                                                  MerkleTreeId id,
+                                                                  const std::vector<T>& leaves,
+                                                                  index_t start_index) const
+{
+    using namespace crypto::merkle_tree;
+    std::vector<std::optional<index_t>> indices;
+    std::string error_msg;
+    bool success = true;
+
+    Fork::SharedPtr fork = retrieve_fork(rev.forkId);
+
+    Signal signal;
+    auto callback = [&](const TypedResponse<FindLeafIndicesResponse>& response) {
+        success = response.success;
+        error_msg = response.message;
+        indices = response.inner.leaf_indices;
+        signal.signal_level(0);
+    };
+    auto find = [&](const auto& wrapper) {
+        if (rev.blockNumber) {
+            wrapper.tree->find_leaf_indices(leaves, start_index, rev.blockNumber, rev.includeUncommitted, callback);
+        } else {
+            wrapper.tree->find_leaf_indices(leaves, start_index, rev.includeUncommitted, callback);
+        }
+    };
+    if constexpr (std::is_same_v<bb::fr, T>) {
+        find(std::get<TreeWithStore<FrTree>>(fork->_trees.at(id)));
+    } else {
+        using Store = ContentAddressedCachedTreeStore<T>;
+        using Tree = ContentAddressedIndexedTree<Store, HashPolicy>;
+        find(std::get<TreeWithStore<Tree>>(fork->_trees.at(id)));
+    }
+
+    signal.wait_for_level(0);
+    if (!success) {
+        throw std::runtime_error(error_msg);
+    }
+    return indices;
+}
+
 template <typename T> void WorldState::append_leaves(MerkleTreeId id, const std::vector<T>& leaves, Fork::Id fork_id)
 {
     using namespace crypto::merkle_tree;
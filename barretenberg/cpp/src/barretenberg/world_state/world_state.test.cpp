@@ -448,6 +448,47 @@ TEST_F(WorldStateTest, PublicDataTree)
     EXPECT_EQ(leaf.value().value, PublicDataLeafValue(142, 1));
 }
 
+TEST_F(WorldStateTest, BatchedReadsMatchSingleReads)
+{
+    WorldState ws(4, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+    std::vector<fr> notes;
+    for (size_t i = 0; i < 100; ++i) {
+        notes.emplace_back(i + 1);
+    }
+    ws.append_leaves<fr>(tree_id, notes);
+    ws.commit();
+
+    // unsorted, with duplicates and one index past the end of the tree
+    std::vector<index_t> indices{ 99, 0, 1, 64, 63, 0, 17, 200 };
+    for (auto revision : { WorldStateRevision::committed(), WorldStateRevision::uncommitted() }) {
+        auto paths = ws.get_sibling_paths(revision, tree_id, indices);
+        auto leaves = ws.get_leaves<fr>(revision, tree_id, indices);
+        ASSERT_EQ(paths.size(), indices.size());
+        ASSERT_EQ(leaves.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            EXPECT_EQ(paths[i], ws.get_sibling_path(revision, tree_id, indices[i]));
+            EXPECT_EQ(leaves[i], ws.get_leaf<fr>(revision, tree_id, indices[i]));
+        }
+
+        auto found = ws.find_leaf_indices<fr>(revision, tree_id, { fr(1), fr(100), fr(1000) });
+        EXPECT_EQ(found, (std::vector<std::optional<index_t>>{ 0, 99, std::nullopt }));
+    }
+
+    auto nullifier_tree_id = MerkleTreeId::NULLIFIER_TREE;
+    ws.append_leaves<NullifierLeafValue>(nullifier_tree_id, { NullifierLeafValue(142) });
+    std::vector<fr> keys{ 143, 142, 0, 50 };
+    auto low_leaves = ws.find_low_leaf_indices(WorldStateRevision::uncommitted(), nullifier_tree_id, keys);
+    ASSERT_EQ(low_leaves.size(), keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(low_leaves[i],
+                  ws.find_low_leaf_index(WorldStateRevision::uncommitted(), nullifier_tree_id, keys[i]));
+    }
+    auto nullifiers =
+        ws.get_leaves<NullifierLeafValue>(WorldStateRevision::uncommitted(), nullifier_tree_id, { 128, 1000 });
+    EXPECT_EQ(nullifiers, (std::vector<std::optional<NullifierLeafValue>>{ NullifierLeafValue(142), std::nullopt }));
+}
+
 TEST_F(WorldStateTest, CommitsAndRollsBackAllTrees)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -158,6 +158,22 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
         WorldStateMessageType::FIND_LOW_LEAF,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_low_leaf(obj, buffer); });
 
+    _dispatcher.registerTarget(
+        WorldStateMessageType::GET_LEAF_VALUES,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_leaf_values(obj, buffer); });
+
+    _dispatcher.registerTarget(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
+    _dispatcher.registerTarget(
+        WorldStateMessageType::FIND_LEAF_INDICES,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_leaf_indices(obj, buffer); });
+
+    _dispatcher.registerTarget(
+        WorldStateMessageType::FIND_LOW_LEAVES,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_low_leaves(obj, buffer); });
+
     _dispatcher.registerTarget(
         WorldStateMessageType::APPEND_LEAVES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return append_leaves(obj, buffer); });
@@ -436,6 +452,129 @@ bool WorldStateAddon::find_low_leaf(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateAddon::get_leaf_values(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetLeafValuesRequest> request;
+    obj.convert(request);
+
+    MsgHeader header(request.header.messageId);
+
+    switch (request.value.treeId) {
+    case MerkleTreeId::NOTE_HASH_TREE:
+    case MerkleTreeId::L1_TO_L2_MESSAGE_TREE:
+    case MerkleTreeId::ARCHIVE: {
+        auto leaves =
+            _ws->get_leaves<bb::fr>(request.value.revision, request.value.treeId, request.value.leafIndices);
+        messaging::TypedMessage<std::vector<std::optional<bb::fr>>> resp_msg(
+            WorldStateMessageType::GET_LEAF_VALUES, header, leaves);
+        msgpack::pack(buffer, resp_msg);
+        break;
+    }
+
+    case MerkleTreeId::PUBLIC_DATA_TREE: {
+        auto leaves = _ws->get_leaves<crypto::merkle_tree::PublicDataLeafValue>(
+            request.value.revision, request.value.treeId, request.value.leafIndices);
+        messaging::TypedMessage<std::vector<std::optional<PublicDataLeafValue>>> resp_msg(
+            WorldStateMessageType::GET_LEAF_VALUES, header, leaves);
+        msgpack::pack(buffer, resp_msg);
+        break;
+    }
+
+    case MerkleTreeId::NULLIFIER_TREE: {
+        auto leaves = _ws->get_leaves<crypto::merkle_tree::NullifierLeafValue>(
+            request.value.revision, request.value.treeId, request.value.leafIndices);
+        messaging::TypedMessage<std::vector<std::optional<NullifierLeafValue>>> resp_msg(
+            WorldStateMessageType::GET_LEAF_VALUES, header, leaves);
+        msgpack::pack(buffer, resp_msg);
+        break;
+    }
+
+    default:
+        throw std::runtime_error("Unsupported tree type");
+    }
+
+    return true;
+}
+
+bool WorldStateAddon::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    std::vector<fr_sibling_path> paths =
+        _ws->get_sibling_paths(request.value.revision, request.value.treeId, request.value.leafIndices);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<fr_sibling_path>> resp_msg(
+        WorldStateMessageType::GET_SIBLING_PATHS, header, paths);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateAddon::find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<TreeIdAndRevisionRequest> request;
+    obj.convert(request);
+
+    std::vector<std::optional<index_t>> indices;
+    switch (request.value.treeId) {
+    case MerkleTreeId::NOTE_HASH_TREE:
+    case MerkleTreeId::L1_TO_L2_MESSAGE_TREE:
+    case MerkleTreeId::ARCHIVE: {
+        TypedMessage<FindLeafIndicesRequest<bb::fr>> r1;
+        obj.convert(r1);
+        indices = _ws->find_leaf_indices<bb::fr>(
+            request.value.revision, request.value.treeId, r1.value.leaves, r1.value.startIndex);
+        break;
+    }
+
+    case MerkleTreeId::PUBLIC_DATA_TREE: {
+        TypedMessage<FindLeafIndicesRequest<crypto::merkle_tree::PublicDataLeafValue>> r2;
+        obj.convert(r2);
+        indices = _ws->find_leaf_indices<PublicDataLeafValue>(
+            request.value.revision, request.value.treeId, r2.value.leaves, r2.value.startIndex);
+        break;
+    }
+    case MerkleTreeId::NULLIFIER_TREE: {
+        TypedMessage<FindLeafIndicesRequest<crypto::merkle_tree::NullifierLeafValue>> r3;
+        obj.convert(r3);
+        indices = _ws->find_leaf_indices<NullifierLeafValue>(
+            request.value.revision, request.value.treeId, r3.value.leaves, r3.value.startIndex);
+        break;
+    }
+    }
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<std::optional<index_t>>> resp_msg(
+        WorldStateMessageType::FIND_LEAF_INDICES, header, indices);
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateAddon::find_low_leaves(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<FindLowLeavesRequest> request;
+    obj.convert(request);
+
+    std::vector<GetLowIndexedLeafResponse> low_leaves =
+        _ws->find_low_leaf_indices(request.value.revision, request.value.treeId, request.value.keys);
+
+    std::vector<FindLowLeafResponse> results;
+    results.reserve(low_leaves.size());
+    for (const auto& low_leaf_info : low_leaves) {
+        results.push_back({ low_leaf_info.is_already_present, low_leaf_info.index });
+    }
+
+    MsgHeader header(request.header.messageId);
+    TypedMessage<std::vector<FindLowLeafResponse>> response(WorldStateMessageType::FIND_LOW_LEAVES, header, results);
+    msgpack::pack(buffer, response);
+
+    return true;
+}
+
 bool WorldStateAddon::append_leaves(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<TreeIdOnlyRequest> request;
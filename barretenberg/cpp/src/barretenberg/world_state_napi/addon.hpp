@@ -42,6 +42,11 @@ class WorldStateAddon : public Napi::ObjectWrap<WorldStateAddon> {
     bool find_leaf_index(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool find_low_leaf(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 
+    bool get_leaf_values(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+    bool find_low_leaves(msgpack::object& obj, msgpack::sbuffer& buffer) const;
+
     bool append_leaves(msgpack::object& obj, msgpack::sbuffer& buffer);
     bool batch_insert(msgpack::object& obj, msgpack::sbuffer& buffer);
 
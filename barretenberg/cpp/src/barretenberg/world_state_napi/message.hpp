@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace bb::world_state {
 
@@ -43,6 +44,11 @@ enum WorldStateMessageType {
 
     GET_STATUS,
 
+    GET_LEAF_VALUES,
+    GET_SIBLING_PATHS,
+    FIND_LEAF_INDICES,
+    FIND_LOW_LEAVES,
+
     CLOSE = 999,
 };
 
@@ -148,6 +154,35 @@ struct FindLowLeafResponse {
     MSGPACK_FIELDS(alreadyPresent, index);
 };
 
+struct GetLeafValuesRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
+struct GetSiblingPathsRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
+template <typename T> struct FindLeafIndicesRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<T> leaves;
+    index_t startIndex;
+    MSGPACK_FIELDS(treeId, revision, leaves, startIndex);
+};
+
+struct FindLowLeavesRequest {
+    MerkleTreeId treeId;
+    WorldStateRevision revision;
+    std::vector<fr> keys;
+    MSGPACK_FIELDS(treeId, revision, keys);
+};
+
 struct BlockShiftRequest {
     index_t toBlockNumber;
     MSGPACK_FIELDS(toBlockNumber);
@@ -77,6 +77,11 @@ export enum WorldStateMessageType {
 
   GET_STATUS,
 
+  GET_LEAF_VALUES,
+  GET_SIBLING_PATHS,
+  FIND_LEAF_INDICES,
+  FIND_LOW_LEAVES,
+
   CLOSE = 999,
 }
 
@@ -163,6 +168,26 @@ interface FindLowLeafResponse {
   alreadyPresent: boolean;
 }
 
+interface GetLeafValuesRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+type GetLeafValuesResponse = Array<SerializedLeafValue | undefined>;
+
+interface GetSiblingPathsRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+type GetSiblingPathsResponse = Buffer[][];
+
+interface FindLeafIndicesRequest extends WithTreeId, WithLeaves, WithWorldStateRevision {
+  startIndex: bigint;
+}
+type FindLeafIndicesResponse = Array<bigint | null>;
+
+interface FindLowLeavesRequest extends WithTreeId, WithWorldStateRevision {
+  keys: Fr[];
+}
+type FindLowLeavesResponse = FindLowLeafResponse[];
+
 interface AppendLeavesRequest extends WithTreeId, WithForkId, WithLeaves {}
 
 interface BatchInsertRequest extends WithTreeId, WithForkId, WithLeaves {
@@ -249,6 +274,11 @@ export type WorldStateRequest = {
 
   [WorldStateMessageType.GET_STATUS]: void;
 
+  [WorldStateMessageType.GET_LEAF_VALUES]: GetLeafValuesRequest;
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
+  [WorldStateMessageType.FIND_LEAF_INDICES]: FindLeafIndicesRequest;
+  [WorldStateMessageType.FIND_LOW_LEAVES]: FindLowLeavesRequest;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 
@@ -283,6 +313,11 @@ export type WorldStateResponse = {
 
   [WorldStateMessageType.GET_STATUS]: WorldStateStatus;
 
+  [WorldStateMessageType.GET_LEAF_VALUES]: GetLeafValuesResponse;
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
+  [WorldStateMessageType.FIND_LEAF_INDICES]: FindLeafIndicesResponse;
+  [WorldStateMessageType.FIND_LOW_LEAVES]: FindLowLeavesResponse;
+
   [WorldStateMessageType.CLOSE]: void;
 };
 